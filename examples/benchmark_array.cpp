@@ -0,0 +1,126 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// timings of std::vector<nd::array> workloads that depend on nd::array being trivially copyable
+// (copies / reallocations become memcpy / memmove) and on nd::uninitialized temporaries
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <nd/array.h>
+
+namespace
+{
+using mat3 = nd::array<float, 3, 3>;
+
+constexpr std::size_t num_elements = std::size_t(1) << 16;
+constexpr int         num_runs     = 200;
+
+template<typename F>
+void
+benchmark(const std::string& name, F&& f)
+{
+    double best = 1e30;
+    float  sink = 0;
+
+    for (int r = 0; r < num_runs; ++r)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        sink += f();
+        const auto stop = std::chrono::steady_clock::now();
+
+        best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+
+    std::cout << name << ": " << best << " ms (" << (best * 1e6 / num_elements) << " ns / element)"
+              << (sink == 12345.f ? " " : "") << std::endl; // keep the results alive
+}
+} // namespace
+
+int
+main()
+{
+    std::cout << "std::vector<nd::array<float, 3, 3>> with " << num_elements << " elements, best of " << num_runs << " runs" << std::endl;
+    std::cout << "trivially copyable: " << std::boolalpha << std::is_trivially_copyable_v<mat3> << std::endl;
+
+    std::vector<mat3> src(num_elements);
+    for (std::size_t i = 0; i < num_elements; ++i)
+    {
+        src[i].fill(static_cast<float>(i & 255));
+    }
+
+    benchmark("copy vector        ", [&]
+    {
+        const std::vector<mat3> dst(src);
+        return dst.back()[8];
+    });
+
+    benchmark("push_back (growing)", [&]
+    {
+        std::vector<mat3> dst;
+        for (const mat3& m : src)
+        {
+            dst.push_back(m);
+        }
+        return dst.back()[8];
+    });
+
+    benchmark("erase front 1/64   ", [&]
+    {
+        std::vector<mat3> dst(src);
+        dst.erase(dst.begin(), dst.begin() + num_elements / 64);
+        return dst.front()[0];
+    });
+
+    std::vector<mat3> dst(num_elements);
+
+    benchmark("temporary (zeroed) ", [&]
+    {
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            mat3 t;
+            std::transform(src[i].begin(), src[i].end(), t.begin(), [](float x) { return 2 * x; });
+            dst[i] = t;
+        }
+        return dst.back()[8];
+    });
+
+    benchmark("temporary (uninit) ", [&]
+    {
+        for (std::size_t i = 0; i < num_elements; ++i)
+        {
+            mat3 t(nd::uninitialized);
+            std::transform(src[i].begin(), src[i].end(), t.begin(), [](float x) { return 2 * x; });
+            dst[i] = t;
+        }
+        return dst.back()[8];
+    });
+
+    return 0;
+}
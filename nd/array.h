@@ -27,16 +27,23 @@
 #ifndef __ND_ARRAY_H__dfneluirgneriugeuivnjisdjfkjds
 #define __ND_ARRAY_H__dfneluirgneriugeuivnjisdjfkjds
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
 #include <iterator>
+#include <numeric>
 #include <ostream>
-#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#include "charconv.h"
+#include "layout.h"
+#include "mdspan.h"
 
 #if !defined(__GNUC__) || defined(__MINGW32__)
   #define ND_FORCE_INLINE __forceinline
@@ -49,8 +56,18 @@
 //====================================================================================================
 namespace nd
 {
-template<typename TValue, std::size_t... TSizes>
-class array
+//! tag type of nd::uninitialized
+struct uninitialized_t
+{
+    explicit constexpr uninitialized_t() = default;
+};
+
+//! tag for constructors that leave the values uninitialized, e.g. nd::array<float, 3, 3> a(nd::uninitialized);
+inline constexpr uninitialized_t uninitialized{};
+
+//! fixed-size n-dimensional array with selectable memory layout; use the alias nd::array for the default layout
+template<typename TValue, layout TLayout, std::size_t... TSizes>
+class basic_array
 {
     //------------------------------------------------------------------------------------------------------
     // assertions
@@ -74,7 +91,13 @@ class array
         return (TSizes * ...);
     }
 
-    using self_type = array<TValue, TSizes...>;
+    [[nodiscard]] ND_FORCE_INLINE static constexpr layout
+    memory_layout() noexcept
+    {
+        return TLayout;
+    }
+
+    using self_type = basic_array<TValue, TLayout, TSizes...>;
     using value_type = TValue;
     using data_container_type = std::array<value_type, num_values()>;
     using size_type = std::size_t;
@@ -124,6 +147,15 @@ class array
         return res;
     }
 
+    //! the special members are defaulted, so the array is exactly as trivial as its value type
+    static constexpr void
+    _assert_trivial() noexcept
+    {
+        static_assert(!std::is_trivially_copyable_v<value_type> || std::is_trivially_copyable_v<self_type>, "array must be trivially copyable if the value type is");
+        static_assert(!std::is_standard_layout_v<value_type> || std::is_standard_layout_v<self_type>, "array must have standard layout if the value type has");
+        static_assert(sizeof(self_type) == sizeof(data_container_type), "array must not add members or padding to its values");
+    }
+
     template<typename TIndexAccessible>
     [[nodiscard]] static constexpr data_container_type
     _copy_array(TIndexAccessible&& arr) noexcept
@@ -145,48 +177,53 @@ class array
     // used for arithmetic types like string
     template<typename T = value_type, std::enable_if_t<std::is_arithmetic_v<T>>* = nullptr>
     ND_FORCE_INLINE constexpr
-    array() noexcept :
+    basic_array() noexcept :
         _values{_constant_array(0)}
-    { /* do nothing */ }
+    { _assert_trivial(); }
 
     // used for non-arithmetic types like string
     template<typename T = value_type, std::enable_if_t<!std::is_arithmetic_v<T>>* = nullptr>
     ND_FORCE_INLINE constexpr
-    array() noexcept :
+    basic_array() noexcept :
         _values{_default_init()}
-    { /* do nothing */ }
+    { _assert_trivial(); }
 
-    ND_FORCE_INLINE constexpr array(const self_type& other) noexcept:
-        _values{_copy_array(other)}
-    { /* do nothing */ }
+    //! leaves arithmetic values uninitialized (e.g. for temporaries that are overwritten anyway); not constexpr
+    ND_FORCE_INLINE explicit
+    basic_array(uninitialized_t) noexcept
+    { _assert_trivial(); }
 
-    ND_FORCE_INLINE constexpr array(self_type&& other) noexcept:
-        _values{_copy_array(std::move(other))}
-    { /* do nothing */ }
+    ND_FORCE_INLINE constexpr basic_array(const self_type&) noexcept = default;
+    ND_FORCE_INLINE constexpr basic_array(self_type&&) noexcept = default;
 
     template<typename TIndexAccessible, std::enable_if_t<std::is_class_v<std::decay_t<TIndexAccessible>> && !std::is_same_v<std::decay_t<TIndexAccessible>, value_type>>* = nullptr>
     ND_FORCE_INLINE constexpr
-    array(const TIndexAccessible& other) noexcept :
+    basic_array(const TIndexAccessible& other) noexcept :
         _values{_copy_array(other)}
-    { /* do nothing */ }
+    {
+        if constexpr (detail::layout_of<TIndexAccessible>::known && num_dimensions() > 1)
+        {
+            static_assert(detail::layout_of<TIndexAccessible>::value == TLayout, "values are copied in list order, which requires the same memory layout");
+        }
+    }
 
     template<typename... TValues, std::enable_if_t<sizeof...(TValues) == num_values() && std::conjunction_v<std::is_convertible<std::decay_t<TValues>, value_type>...>>* = nullptr>
     ND_FORCE_INLINE constexpr
-    array(TValues&& ... values) noexcept :
+    basic_array(TValues&& ... values) noexcept :
         _values{static_cast<value_type>(std::forward<TValues>(values))...}
     { /* do nothing */ }
 
     //------------------------------------------------------------------------------------------------------
     // dtor
     //------------------------------------------------------------------------------------------------------
-    ND_FORCE_INLINE ~array() noexcept = default;
+    ND_FORCE_INLINE ~basic_array() noexcept = default;
 
     //------------------------------------------------------------------------------------------------------
     // assignment
     //------------------------------------------------------------------------------------------------------
     template<typename T, std::enable_if_t<!std::is_same_v<T, value_type>>* = nullptr>
     [[maybe_unused]] ND_FORCE_INLINE constexpr self_type&
-    operator=(array<T, TSizes...>& other) noexcept
+    operator=(basic_array<T, TLayout, TSizes...>& other) noexcept
     {
         for (size_type i = 0; i < num_values(); ++i)
         {
@@ -206,11 +243,11 @@ class array
     // cast
     //------------------------------------------------------------------------------------------------------
     template<typename T>
-    [[nodiscard]] ND_FORCE_INLINE constexpr array<T, TSizes...>
+    [[nodiscard]] ND_FORCE_INLINE constexpr basic_array<T, TLayout, TSizes...>
     cast() const noexcept
     {
         static_assert(std::is_convertible_v<value_type, T>, "cannot cast types");
-        return array<T, TSizes...>(*this);
+        return basic_array<T, TLayout, TSizes...>(*this);
     }
 
     //------------------------------------------------------------------------------------------------------
@@ -241,32 +278,37 @@ class array
     // stride
     //------------------------------------------------------------------------------------------------------
   private:
-    template<typename... Sizes>
+    //! dimension with the k-th largest stride
     [[nodiscard]] ND_FORCE_INLINE static constexpr size_type
-    __stride_of_dim(size_type skip, size_type s0, Sizes... s) noexcept
+    _dim_by_stride(size_type k) noexcept
     {
-        if (skip > 0)
+        return TLayout == layout::last_axis_contiguous ? k : num_dimensions() - 1 - k;
+    }
+
+    //! product of the sizes of all dimensions that are stored more contiguously than dimId
+    [[nodiscard]] ND_FORCE_INLINE static constexpr size_type
+    _stride_of_dim(size_type dimId) noexcept
+    {
+        const std::array<size_type, num_dimensions()> s{{TSizes...}};
+
+        size_type res = 1U;
+
+        if constexpr (TLayout == layout::last_axis_contiguous)
         {
-            if constexpr (sizeof...(Sizes) == 0)
-            {
-                return 1U;
-            }
-            else
+            for (size_type k = dimId + 1; k < num_dimensions(); ++k)
             {
-                return __stride_of_dim(skip - 1, s...);
+                res *= s[k];
             }
         }
         else
         {
-            return s0 * (s * ... * 1U);
+            for (size_type k = 0; k < dimId; ++k)
+            {
+                res *= s[k];
+            }
         }
-    }
 
-    template<typename... Sizes>
-    [[nodiscard]] ND_FORCE_INLINE static constexpr size_type
-    _stride_of_dim(size_type dimId, Sizes... s) noexcept
-    {
-        return __stride_of_dim(dimId + 1, s...);
+        return res;
     }
 
     template<std::size_t... Is>
@@ -281,7 +323,7 @@ class array
     [[nodiscard]] ND_FORCE_INLINE static constexpr size_type
     stride(size_type dimId) noexcept
     {
-        return _stride_of_dim(dimId, TSizes...);
+        return _stride_of_dim(dimId);
     }
 
     [[nodiscard]] ND_FORCE_INLINE static constexpr std::array<size_type, num_dimensions()>
@@ -293,34 +335,56 @@ class array
     //------------------------------------------------------------------------------------------------------
     // list id / grid id conversion
     //------------------------------------------------------------------------------------------------------
-    [[nodiscard]] static constexpr std::array<size_type, num_dimensions()>
-    list_to_grid_id(size_type lid) noexcept
+  private:
+    //! coordinate of the dimension with the K-th largest stride; divides by a compile-time constant (multiply / shift)
+    template<size_type K>
+    ND_FORCE_INLINE static constexpr void
+    _list_to_grid_id_step(size_type& lid, std::array<size_type, num_dimensions()>& gid) noexcept
     {
-        assert(lid < num_values());
+        constexpr size_type d = _dim_by_stride(K);
+        constexpr size_type s = stride(d);
 
+        gid[d] = lid / s;
+        lid -= gid[d] * s;
+    }
+
+    template<std::size_t... Ks>
+    [[nodiscard]] ND_FORCE_INLINE static constexpr std::array<size_type, num_dimensions()>
+    _list_to_grid_id(size_type lid, std::index_sequence<Ks...>) noexcept
+    {
         std::array<size_type, num_dimensions()> gid{};
 
-        constexpr auto str = strides();
+        // strides from largest to smallest, unrolled; the contiguous dimension gets the remainder
+        (_list_to_grid_id_step<Ks>(lid, gid), ...);
+        gid[_dim_by_stride(num_dimensions() - 1)] = lid;
 
-        for (size_type i = 0; i < num_dimensions() - 1; ++i)
+        return gid;
+    }
+
+  public:
+    [[nodiscard]] static constexpr std::array<size_type, num_dimensions()>
+    list_to_grid_id(size_type lid) noexcept
+    {
+        assert(lid < num_values());
+        return _list_to_grid_id(lid, std::make_index_sequence<num_dimensions() - 1>());
+    }
+
+    //! list_to_grid_id() for each list id in [first, last); writes num_dimensions() coordinates per id to out
+    template<typename TInputIterator, typename TOutputIterator>
+    static constexpr TOutputIterator
+    list_to_grid_ids(TInputIterator first, TInputIterator last, TOutputIterator out)
+    {
+        for (; first != last; ++first)
         {
-            gid[i] = lid;
+            const auto gid = list_to_grid_id(static_cast<size_type>(*first));
 
-            for (size_type k = 0; k < i; ++k)
+            for (const size_type x: gid)
             {
-                gid[i] -= str[k] * gid[k];
+                *out++ = x;
             }
-
-            gid[i] /= str[i];
         }
 
-        gid[num_dimensions() - 1] = lid;
-        for (size_type i = 0; i < num_dimensions() - 1; ++i)
-        {
-            gid[num_dimensions() - 1] -= str[i] * gid[i];
-        }
-
-        return gid;
+        return out;
     }
 
   private:
@@ -396,6 +460,38 @@ class array
         return std::move(_values);
     }
 
+    //------------------------------------------------------------------------------------------------------
+    // span / mdspan
+    //------------------------------------------------------------------------------------------------------
+    using mdspan_type = mdspan<value_type, md_extents<TSizes...>, detail::mdspan_layout_t<TLayout>>;
+    using const_mdspan_type = mdspan<const value_type, md_extents<TSizes...>, detail::mdspan_layout_t<TLayout>>;
+
+    //! zero-copy view of all values in list order
+    [[nodiscard]] constexpr span<value_type>
+    as_span() noexcept
+    {
+        return span<value_type>(_values.data(), _values.size());
+    }
+
+    [[nodiscard]] constexpr span<const value_type>
+    as_span() const noexcept
+    {
+        return span<const value_type>(_values.data(), _values.size());
+    }
+
+    //! zero-copy view with static extents
+    [[nodiscard]] constexpr mdspan_type
+    as_mdspan() noexcept
+    {
+        return mdspan_type(_values.data(), typename mdspan_type::extents_type());
+    }
+
+    [[nodiscard]] constexpr const_mdspan_type
+    as_mdspan() const noexcept
+    {
+        return const_mdspan_type(_values.data(), typename const_mdspan_type::extents_type());
+    }
+
     //------------------------------------------------------------------------------------------------------
     // operator[]
     //------------------------------------------------------------------------------------------------------
@@ -652,7 +748,7 @@ class array
     //------------------------------------------------------------------------------------------------------
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     void
-    swap(array<K, TSizes...>& other) noexcept
+    swap(basic_array<K, TLayout, TSizes...>& other) noexcept
     {
         for (size_type i = 0; i < num_values(); ++i)
         {
@@ -664,7 +760,7 @@ class array
 
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     void
-    swap(array<K, TSizes...>&& other) noexcept
+    swap(basic_array<K, TLayout, TSizes...>&& other) noexcept
     {
         for (size_type i = 0; i < num_values(); ++i)
         {
@@ -689,7 +785,7 @@ class array
     //------------------------------------------------------------------------------------------------------
     template<typename K, std::size_t... S>
     [[nodiscard]] constexpr bool
-    operator==(const array<K, S...>& other) const noexcept
+    operator==(const basic_array<K, TLayout, S...>& other) const noexcept
     {
         if constexpr (num_dimensions() != other.num_dimensions())
         {
@@ -719,7 +815,7 @@ class array
 
     template<typename K, std::size_t... S>
     [[nodiscard]] constexpr bool
-    operator<(const array<K, S...>& other) const noexcept
+    operator<(const basic_array<K, TLayout, S...>& other) const noexcept
     {
         static_assert(num_dimensions() == other.num_dimensions(), "less operator is only defined for arrays with same dimensionality!");
         static_assert(((TSizes == S) && ...), "less operator is only defined for same-sized arrays");
@@ -737,28 +833,28 @@ class array
 
     template<typename K, std::size_t... S>
     [[nodiscard]] ND_FORCE_INLINE constexpr bool
-    operator!=(const array<K, S...>& other) const noexcept
+    operator!=(const basic_array<K, TLayout, S...>& other) const noexcept
     {
         return !operator==(other);
     }
 
     template<typename K, std::size_t... S>
     [[nodiscard]] ND_FORCE_INLINE constexpr bool
-    operator>(const array<K, S...>& other) const noexcept
+    operator>(const basic_array<K, TLayout, S...>& other) const noexcept
     {
         return !operator<=(other);
     }
 
     template<typename K, std::size_t... S>
     [[nodiscard]] ND_FORCE_INLINE constexpr bool
-    operator>=(const array<K, S...>& other) const noexcept
+    operator>=(const basic_array<K, TLayout, S...>& other) const noexcept
     {
         return !operator<(other);
     }
 
     template<typename K, std::size_t... S>
     [[nodiscard]] ND_FORCE_INLINE constexpr bool
-    operator<=(const array<K, S...>& other) const noexcept
+    operator<=(const basic_array<K, TLayout, S...>& other) const noexcept
     {
         return operator<(other) || operator==(other);
     }
@@ -766,90 +862,184 @@ class array
     //------------------------------------------------------------------------------------------------------
     // to string
     //------------------------------------------------------------------------------------------------------
-    [[nodiscard]] std::string
-    to_string() const
+  private:
+    [[nodiscard]] std::size_t
+    _estimated_string_length() const noexcept
+    {
+        // rough guess per value incl. separator; 3D+ additionally prints the grid id of each value
+        constexpr std::size_t charsPerValue = std::is_floating_point_v<value_type> ? 12U : 6U;
+        const std::size_t     charsPerId    = num_dimensions() > 2 ? 4U * num_dimensions() + 3U : 0U;
+
+        return 2U + num_values() * (charsPerValue + charsPerId);
+    }
+
+    void
+    _format(std::string& s) const
     {
-        std::stringstream s;
+        s += '[';
 
         if constexpr (num_dimensions() == 1)
         {
-            s << "[";
-
             for (size_type i = 0; i < num_values(); ++i)
             {
-                s << operator[](i);
-
-                if (i < num_values() - 1)
+                if (i != 0)
                 {
-                    s << ", ";
+                    s += ", ";
                 }
-            }
 
-            s << "]";
+                detail::append_value(s, _values[i]);
+            }
         }
         else if constexpr (num_dimensions() == 2)
         {
-            s << "[";
-
+            // each printed row contains the values along dimension 0
             for (size_type y = 0; y < size(1); ++y)
             {
                 if (y != 0)
                 {
-                    s << " ";
+                    s += "\n ";
                 }
 
-                s << "[";
+                s += '[';
 
-                for (size_type x = 0; x < size(0); ++x)
+                size_type lid = y * stride(1);
+                for (size_type x = 0; x < size(0); ++x, lid += stride(0))
                 {
-                    s << at_grid(x, y);
-
-                    if (x < size(0) - 1)
+                    if (x != 0)
                     {
-                        s << ", ";
+                        s += ", ";
                     }
-                }
-
-                s << "]";
 
-                if (y < size(1) - 1)
-                {
-                    s << "\n";
+                    detail::append_value(s, _values[lid]);
                 }
-            }
 
-            s << "]";
+                s += ']';
+            }
         }
         else
         {
-            s << "[";
+            // values are printed with the last dimension running fastest regardless of the memory layout;
+            // the list id is advanced along with the grid id instead of being recomputed via grid_to_list_id()
+            std::array<size_type, num_dimensions()> gid{};
+            size_type                               lid = 0;
 
             for (size_type i = 0; i < num_values(); ++i)
             {
-                const auto gid = list_to_grid_id(i);
-                s << "(";
-                for (size_type k = 0; k < gid.size(); ++k)
+                if (i != 0)
                 {
-                    s << gid[k];
-                    if (k < gid.size() - 1)
+                    s += ", ";
+                }
+
+                s += '(';
+                for (size_type k = 0; k < num_dimensions(); ++k)
+                {
+                    if (k != 0)
                     {
-                        s << ",";
+                        s += ',';
                     }
+
+                    detail::append_index(s, gid[k]);
                 }
-                s << ")=";
+                s += ")=";
 
-                s << operator[](i);
+                detail::append_value(s, _values[lid]);
 
-                if (i < num_values() - 1)
+                for (size_type k = num_dimensions(); k-- > 0;)
                 {
-                    s << ", ";
+                    if (++gid[k] < size(k))
+                    {
+                        lid += stride(k);
+                        break;
+                    }
+
+                    lid -= (size(k) - 1) * stride(k);
+                    gid[k] = 0;
                 }
             }
+        }
+
+        s += ']';
+    }
+
+  public:
+
+    [[nodiscard]] std::string
+    to_string() const
+    {
+        std::string s;
+        s.reserve(_estimated_string_length());
+        _format(s);
+        return s;
+    }
 
-            s << "]";
+    //! writes to_string() to an output iterator, e.g., std::ostreambuf_iterator<char> or std::back_inserter
+    template<typename TOutputIterator>
+    TOutputIterator
+    format_to(TOutputIterator out) const
+    {
+        const std::string s = to_string();
+        return std::copy(s.begin(), s.end(), out);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // from string
+    //------------------------------------------------------------------------------------------------------
+  public:
+    //! inverse of to_string()
+    [[nodiscard]] static self_type
+    from_string(std::string_view str)
+    {
+        std::vector<size_type>  sizes;
+        std::vector<value_type> values;
+        detail::parse_string(str, sizes, values);
+
+        constexpr auto s = size();
+
+        if (sizes.size() != num_dimensions() || !std::equal(sizes.begin(), sizes.end(), s.begin()))
+        {
+            throw std::invalid_argument("from_string: sizes do not match");
+        }
+
+        self_type res(uninitialized);
+
+        if constexpr (num_dimensions() == 2)
+        {
+            for (size_type y = 0, t = 0; y < size(1); ++y)
+            {
+                for (size_type x = 0; x < size(0); ++x)
+                {
+                    res._values[x * stride(0) + y * stride(1)] = values[t++];
+                }
+            }
+        }
+        else if constexpr (TLayout == layout::last_axis_contiguous)
+        {
+            std::copy(values.begin(), values.end(), res._values.begin());
+        }
+        else
+        {
+            std::array<size_type, num_dimensions()> gid{};
+            size_type                               lid = 0;
+
+            for (size_type t = 0; t < num_values(); ++t)
+            {
+                res._values[lid] = values[t];
+
+                for (size_type k = num_dimensions(); k-- > 0;)
+                {
+                    if (++gid[k] < size(k))
+                    {
+                        lid += stride(k);
+                        break;
+                    }
+
+                    lid -= (size(k) - 1) * stride(k);
+                    gid[k] = 0;
+                }
+            }
         }
 
-        return s.str();
+        return res;
     }
 
     //------------------------------------------------------------------------------------------------------
@@ -874,15 +1064,18 @@ class array
     {
         return Constant(static_cast<value_type>(1));
     }
-}; // class array
+}; // class basic_array
+
+template<typename TValue, std::size_t... TSizes>
+using array = basic_array<TValue, layout::last_axis_contiguous, TSizes...>;
 } // namespace nd
 
 //------------------------------------------------------------------------------------------------------
 // external stream operator
 //------------------------------------------------------------------------------------------------------
-template<typename T, std::size_t... S>
+template<typename T, nd::layout L, std::size_t... S>
 [[maybe_unused]] std::ostream&
-operator<<(std::ostream& o, const nd::array<T, S...>& v)
+operator<<(std::ostream& o, const nd::basic_array<T, L, S...>& v)
 {
     o << v.to_string();
     return o;
@@ -891,23 +1084,23 @@ operator<<(std::ostream& o, const nd::array<T, S...>& v)
 //------------------------------------------------------------------------------------------------------
 // external swap
 //------------------------------------------------------------------------------------------------------
-template<typename T, typename K, std::size_t... S>
+template<typename T, typename K, nd::layout L, std::size_t... S>
 ND_FORCE_INLINE inline void
-swap(nd::array<T, S...>& a, nd::array<K, S...>& b) noexcept
+swap(nd::basic_array<T, L, S...>& a, nd::basic_array<K, L, S...>& b) noexcept
 {
     a.swap(b);
 }
 
-template<typename T, typename K, std::size_t... S>
+template<typename T, typename K, nd::layout L, std::size_t... S>
 ND_FORCE_INLINE inline void
-swap(nd::array<T, S...>&& a, nd::array<K, S...>& b) noexcept
+swap(nd::basic_array<T, L, S...>&& a, nd::basic_array<K, L, S...>& b) noexcept
 {
     b.swap(std::move(a));
 }
 
-template<typename T, typename K, std::size_t... S>
+template<typename T, typename K, nd::layout L, std::size_t... S>
 ND_FORCE_INLINE inline void
-swap(nd::array<T, S...>& a, nd::array<K, S...>&& b) noexcept
+swap(nd::basic_array<T, L, S...>& a, nd::basic_array<K, L, S...>&& b) noexcept
 {
     a.swap(std::move(b));
 }
@@ -0,0 +1,264 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_ASYNC_LOADER_H__f4k8s2m6q0w3e7r1t5y9u4i8o2p6
+#define __ND_ASYNC_LOADER_H__f4k8s2m6q0w3e7r1t5y9u4i8o2p6
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//====================================================================================================
+//===== class async_loader
+//====================================================================================================
+/*
+ * Fills containers on a background thread while the caller processes previously filled ones.
+ *
+ *     nd::async_loader<nd::grid<float, 2>> loader([&](nd::grid<float, 2>& g){ return read_next_chunk(g); });
+ *
+ *     while (nd::grid<float, 2>* g = loader.acquire())
+ *     {
+ *         process(*g);
+ *         loader.release(g);
+ *     }
+ *
+ * - numBuffers == 2: double buffering (one buffer is processed while the next one is loaded),
+ *   numBuffers == 3: triple buffering (absorbs jitter in load / process times)
+ * - buffers are reused, so containers keep their capacity between loads
+ * - exceptions thrown by the load function are rethrown by acquire()
+ */
+namespace nd
+{
+template<typename TContainer>
+class async_loader
+{
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    using self_type = async_loader<TContainer>;
+    using container_type = TContainer;
+    //! fills the given buffer; returns false if there is no more data (the buffer is discarded then)
+    using load_function_type = std::function<bool(container_type&)>;
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    load_function_type                _load;
+    std::unique_ptr<container_type[]> _buffers;
+    std::deque<container_type*>       _free;
+    std::deque<container_type*>       _ready;
+    std::exception_ptr                _error;
+    bool                              _finished;
+    bool                              _stop;
+    mutable std::mutex                _mutex;
+    std::condition_variable           _cv_free;
+    std::condition_variable           _cv_ready;
+    std::thread                       _thread;
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    explicit async_loader(load_function_type load, std::size_t numBuffers = 2) :
+        _load(std::move(load))
+        , _buffers(new container_type[std::max<std::size_t>(numBuffers, 1)])
+        , _finished(false)
+        , _stop(false)
+    {
+        assert(numBuffers >= 1 && "at least one buffer is required");
+
+        for (std::size_t i = 0; i < std::max<std::size_t>(numBuffers, 1); ++i)
+        {
+            _free.push_back(&_buffers[i]);
+        }
+
+        _thread = std::thread([this]()
+                              { _run(); });
+    }
+
+    async_loader(const self_type&) = delete;
+    async_loader(self_type&&) = delete;
+
+    //! stops loading after the current load function call returns
+    ~async_loader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+
+        _cv_free.notify_all();
+        _thread.join();
+    }
+
+    self_type& operator=(const self_type&) = delete;
+    self_type& operator=(self_type&&) = delete;
+
+    //------------------------------------------------------------------------------------------------------
+    // background thread
+    //------------------------------------------------------------------------------------------------------
+  private:
+    void
+    _run()
+    {
+        for (;;)
+        {
+            container_type* buffer = nullptr;
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv_free.wait(lock, [this]()
+                { return _stop || !_free.empty(); });
+
+                if (_stop)
+                {
+                    return;
+                }
+
+                buffer = _free.front();
+                _free.pop_front();
+            }
+
+            bool               loaded = false;
+            std::exception_ptr error;
+
+            try
+            { loaded = _load(*buffer); }
+            catch (...)
+            { error = std::current_exception(); }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                if (loaded)
+                {
+                    _ready.push_back(buffer);
+                }
+                else
+                {
+                    _free.push_back(buffer);
+                    _error    = error;
+                    _finished = true;
+                }
+            }
+
+            _cv_ready.notify_one();
+
+            if (!loaded)
+            {
+                return;
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // acquire / release
+    //------------------------------------------------------------------------------------------------------
+  public:
+    //! blocks until the next buffer is loaded; returns nullptr after the last one
+    /*!
+     * rethrows an exception of the load function once all buffers loaded before it were acquired
+     */
+    [[nodiscard]] container_type*
+    acquire()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv_ready.wait(lock, [this]()
+        { return _finished || !_ready.empty(); });
+
+        if (!_ready.empty())
+        {
+            container_type* buffer = _ready.front();
+            _ready.pop_front();
+            return buffer;
+        }
+
+        if (_error)
+        {
+            std::rethrow_exception(std::exchange(_error, nullptr));
+        }
+
+        return nullptr;
+    }
+
+    //! hands an acquired buffer back for the next load
+    void
+    release(container_type* buffer)
+    {
+        assert(buffer != nullptr && "releasing nullptr");
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _free.push_back(buffer);
+        }
+
+        _cv_free.notify_one();
+    }
+
+    //! true if the load function signaled the end and all loaded buffers were acquired
+    [[nodiscard]] bool
+    done() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _finished && _ready.empty() && !_error;
+    }
+}; // class async_loader
+
+//------------------------------------------------------------------------------------------------------
+// files
+//------------------------------------------------------------------------------------------------------
+//! loads one container per file in the background, e.g., load_files_async<nd::grid<double, 2>>(paths, [](const std::string& p){ return nd::read_csv<double>(p); })
+template<typename TContainer, typename TReadFunction>
+[[nodiscard]] async_loader<TContainer>
+load_files_async(std::vector<std::string> paths, TReadFunction read, std::size_t numBuffers = 2)
+{
+    // returned as prvalue (guaranteed copy elision); async_loader is not movable
+    return async_loader<TContainer>(
+        [paths = std::move(paths), read = std::move(read), next = std::size_t(0)](TContainer& buffer) mutable
+        {
+            if (next == paths.size())
+            {
+                return false;
+            }
+
+            buffer = read(paths[next++]);
+            return true;
+        }, numBuffers);
+}
+} // namespace nd
+
+#endif //__ND_ASYNC_LOADER_H__f4k8s2m6q0w3e7r1t5y9u4i8o2p6
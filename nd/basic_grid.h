@@ -0,0 +1,529 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_BASIC_GRID_H__x5c9v3b7n1m5q9w3e7r1t5y9u3i7o1
+#define __ND_BASIC_GRID_H__x5c9v3b7n1m5q9w3e7r1t5y9u3i7o1
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "extents.h"
+#include "grid.h"
+#include "layout.h"
+
+//====================================================================================================
+//===== class basic_grid
+//====================================================================================================
+/*
+ * N-dimensional grid with mixed static / dynamic extents:
+ *
+ *     nd::basic_grid<float, nd::extents<nd::dyn, nd::dyn, 3>> rgb(480, 640); // only the dynamic extents are passed
+ *     rgb(y, x, c) = 1;                                                         // (y * 3 * 640 + x * 3 + c): stride 1 and 3 are constants
+ *
+ *     nd::basic_grid<float, nd::extents<3, 3>> m; // fully static: std::array storage, no stored sizes or strides
+ *
+ * - strides that only depend on static extents are compile-time constants in the index math (static_stride())
+ * - fully static extents use std::array storage, otherwise std::vector
+ * - converts from / to nd::grid with the same rank and layout
+ */
+namespace nd
+{
+template<typename T, typename TExtents, layout TLayout = layout::last_axis_contiguous>
+class basic_grid;
+
+template<typename T, std::size_t... TExtents, layout TLayout>
+class basic_grid<T, extents<TExtents...>, TLayout>
+{
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    using extents_type = nd::extents<TExtents...>;
+
+    [[nodiscard]] static constexpr std::size_t
+    num_dimensions() noexcept
+    {
+        return extents_type::rank();
+    }
+
+    [[nodiscard]] static constexpr layout
+    memory_layout() noexcept
+    {
+        return TLayout;
+    }
+
+    [[nodiscard]] static constexpr bool
+    is_static() noexcept
+    {
+        return extents_type::rank_dynamic() == 0;
+    }
+
+    using self_type = basic_grid<T, extents_type, TLayout>;
+    using value_type = T;
+    using data_container_type = std::conditional_t<is_static(), std::array<T, is_static() ? extents_type::static_num_values() : 1>, std::vector<T>>;
+    using size_type = typename extents_type::size_type;
+    using difference_type = int;
+    using reference = typename data_container_type::reference;
+    using const_reference = typename data_container_type::const_reference;
+    using iterator = typename data_container_type::iterator;
+    using const_iterator = typename data_container_type::const_iterator;
+
+    //! stride of dimension k if it only depends on static extents; nd::dyn otherwise
+    [[nodiscard]] static constexpr std::size_t
+    static_stride(std::size_t k) noexcept
+    {
+        std::size_t s     = 1;
+        std::size_t first = TLayout == layout::last_axis_contiguous ? k + 1 : 0;
+        std::size_t last  = TLayout == layout::last_axis_contiguous ? num_dimensions() : k;
+
+        for (std::size_t i = first; i < last; ++i)
+        {
+            if (extents_type::static_extent(i) == dyn)
+            {
+                return dyn;
+            }
+
+            s *= extents_type::static_extent(i);
+        }
+
+        return s;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    extents_type _extents;
+    //! run-time strides; empty if all extents are static
+    std::array<size_type, is_static() ? 0 : num_dimensions()> _strides{};
+    data_container_type _values{};
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    basic_grid() = default;
+
+    basic_grid(const self_type&) = default;
+
+    basic_grid(self_type&&) noexcept = default;
+
+    //! the dynamic extents in dimension order
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) == extents_type::rank_dynamic() && sizeof...(TSizes) != 0 && std::conjunction_v<std::is_integral<TSizes>...>>* = nullptr>
+    explicit basic_grid(TSizes... dynamicSizes) :
+        basic_grid(extents_type(dynamicSizes...))
+    {
+    }
+
+    explicit basic_grid(const extents_type& e, const value_type& defaultInitValue = value_type())
+    {
+        resize(e, defaultInitValue);
+    }
+
+    //! copies a grid; throws std::invalid_argument if a static extent does not match
+    template<typename K>
+    explicit basic_grid(const grid<K, num_dimensions(), TLayout>& other)
+    {
+        static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
+
+        std::array<size_type, num_dimensions()> dynamicSizes{};
+        std::size_t                             numDynamic = 0;
+
+        for (size_type k = 0; k < num_dimensions(); ++k)
+        {
+            if (extents_type::static_extent(k) == dyn)
+            {
+                dynamicSizes[numDynamic++] = other.size(k);
+            }
+            else if (extents_type::static_extent(k) != other.size(k))
+            {
+                throw std::invalid_argument("basic_grid: size(" + std::to_string(k) + ") is " + std::to_string(other.size(k)) + ", expected "
+                                            + std::to_string(extents_type::static_extent(k)));
+            }
+        }
+
+        resize(_make_extents(dynamicSizes, std::make_index_sequence<extents_type::rank_dynamic()>()), value_type());
+        std::transform(other.data().begin(), other.data().end(), _values.begin(), [](const K& x)
+        {
+            return static_cast<value_type>(x);
+        });
+    }
+
+    ~basic_grid() = default;
+
+    self_type&
+    operator=(const self_type&) = default;
+
+    self_type&
+    operator=(self_type&&) noexcept = default;
+
+  private:
+    template<std::size_t... Is>
+    [[nodiscard]] static extents_type
+    _make_extents(const std::array<size_type, num_dimensions()>& dynamicSizes, std::index_sequence<Is...>)
+    {
+        return extents_type(dynamicSizes[Is]...);
+    }
+
+  public:
+    [[nodiscard]] grid<T, num_dimensions(), TLayout>
+    to_grid() const
+    {
+        const auto s = size();
+        grid<T, num_dimensions(), TLayout> g(s.begin(), s.end(), value_type());
+        std::copy(_values.begin(), _values.end(), g.data().begin());
+        return g;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // sizes / strides
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] const extents_type&
+    extents() const noexcept
+    {
+        return _extents;
+    }
+
+    [[nodiscard]] std::array<size_type, num_dimensions()>
+    size() const noexcept
+    {
+        return _extents.sizes();
+    }
+
+    [[nodiscard]] size_type
+    size(size_type dimId) const noexcept
+    {
+        return _extents.extent(dimId);
+    }
+
+    template<std::size_t K>
+    [[nodiscard]] size_type
+    size() const noexcept
+    {
+        return _extents.template extent<K>();
+    }
+
+    //! stride of dimension K; a constant if it only depends on static extents
+    template<std::size_t K>
+    [[nodiscard]] size_type
+    stride() const noexcept
+    {
+        if constexpr (static_stride(K) != dyn)
+        {
+            return static_cast<size_type>(static_stride(K));
+        }
+        else
+        {
+            return _strides[K];
+        }
+    }
+
+    [[nodiscard]] size_type
+    stride(size_type dimId) const noexcept
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+
+        if constexpr (is_static())
+        {
+            return static_cast<size_type>(static_stride(dimId));
+        }
+        else
+        {
+            return _strides[dimId];
+        }
+    }
+
+    [[nodiscard]] std::array<size_type, num_dimensions()>
+    strides() const noexcept
+    {
+        std::array<size_type, num_dimensions()> s{};
+
+        for (size_type k = 0; k < num_dimensions(); ++k)
+        {
+            s[k] = stride(k);
+        }
+
+        return s;
+    }
+
+    [[nodiscard]] size_type
+    num_values() const noexcept
+    {
+        return static_cast<size_type>(_values.size());
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return _values.empty();
+    }
+
+    [[nodiscard]] data_container_type&
+    data() noexcept
+    {
+        return _values;
+    }
+
+    [[nodiscard]] const data_container_type&
+    data() const noexcept
+    {
+        return _values;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // list id / grid id conversion
+    //------------------------------------------------------------------------------------------------------
+  private:
+    template<std::size_t... Is, typename... Ids>
+    [[nodiscard]] size_type
+    _grid_to_list_id_pack(std::index_sequence<Is...>, const Ids& ... ids) const noexcept
+    {
+        return (0U + ... + (static_cast<size_type>(ids) * stride<Is>()));
+    }
+
+    template<std::size_t... Is, typename TIndexAccessible>
+    [[nodiscard]] size_type
+    _grid_to_list_id_index(std::index_sequence<Is...>, const TIndexAccessible& gid) const noexcept
+    {
+        return (0U + ... + (static_cast<size_type>(gid[Is]) * stride<Is>()));
+    }
+
+  public:
+    template<typename... Ids>
+    [[nodiscard]] bool
+    is_valid_ids(const Ids& ... ids) const noexcept
+    {
+        if constexpr (sizeof...(Ids) == num_dimensions() && std::conjunction_v<std::is_integral<Ids>...>)
+        {
+            size_type k = 0;
+            return ((static_cast<long long>(ids) >= 0 && static_cast<long long>(ids) < static_cast<long long>(size(k++))) && ...);
+        }
+        else
+        {
+            const auto& gid = std::get<0>(std::forward_as_tuple(ids...));
+
+            for (size_type k = 0; k < num_dimensions(); ++k)
+            {
+                if (static_cast<long long>(gid[k]) < 0 || static_cast<long long>(gid[k]) >= static_cast<long long>(size(k)))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] size_type
+    grid_to_list_id(const Ids& ... ids) const noexcept
+    {
+        constexpr bool isIndexPack = sizeof...(Ids) == num_dimensions() && std::conjunction_v<std::is_integral<Ids>...>;
+
+        static_assert(isIndexPack || sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+        assert(is_valid_ids(ids...));
+
+        if constexpr (isIndexPack)
+        {
+            return _grid_to_list_id_pack(std::make_index_sequence<num_dimensions()>(), ids...);
+        }
+        else
+        {
+            return _grid_to_list_id_index(std::make_index_sequence<num_dimensions()>(), std::get<0>(std::forward_as_tuple(ids...)));
+        }
+    }
+
+    [[nodiscard]] std::array<size_type, num_dimensions()>
+    list_to_grid_id(size_type lid) const
+    {
+        assert(lid < num_values());
+
+        std::array<size_type, num_dimensions()> gid{};
+
+        for (size_type k = 0; k < num_dimensions(); ++k)
+        {
+            // dimensions from largest to smallest stride
+            const size_type d = TLayout == layout::last_axis_contiguous ? k : static_cast<size_type>(num_dimensions()) - 1 - k;
+
+            gid[d] = lid / stride(d);
+            lid -= gid[d] * stride(d);
+        }
+
+        return gid;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // access
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] reference
+    operator[](size_type lid)
+    {
+        assert(lid < num_values() && "id out of bounds");
+        return _values[lid];
+    }
+
+    [[nodiscard]] const_reference
+    operator[](size_type lid) const
+    {
+        assert(lid < num_values() && "id out of bounds");
+        return _values[lid];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] reference
+    operator()(const Ids& ... ids)
+    {
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] const_reference
+    operator()(const Ids& ... ids) const
+    {
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] reference
+    at_grid(const Ids& ... ids)
+    {
+        if (!is_valid_ids(ids...))
+        {
+            throw std::out_of_range("invalid vector access!");
+        }
+
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] const_reference
+    at_grid(const Ids& ... ids) const
+    {
+        if (!is_valid_ids(ids...))
+        {
+            throw std::out_of_range("invalid vector access!");
+        }
+
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // iterators
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] iterator
+    begin() noexcept
+    {
+        return _values.begin();
+    }
+
+    [[nodiscard]] const_iterator
+    begin() const noexcept
+    {
+        return _values.begin();
+    }
+
+    [[nodiscard]] iterator
+    end() noexcept
+    {
+        return _values.end();
+    }
+
+    [[nodiscard]] const_iterator
+    end() const noexcept
+    {
+        return _values.end();
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // compare
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] bool
+    operator==(const self_type& other) const
+    {
+        return _extents == other._extents && std::equal(_values.begin(), _values.end(), other._values.begin(), other._values.end());
+    }
+
+    [[nodiscard]] bool
+    operator!=(const self_type& other) const
+    {
+        return !operator==(other);
+    }
+
+    //====================================================================================================
+    //===== SETTER
+    //====================================================================================================
+    //! sets new (dynamic) extents; all values are set to defaultInitValue
+    void
+    resize(const extents_type& e, const value_type& defaultInitValue = value_type())
+    {
+        _extents = e;
+
+        if constexpr (is_static())
+        {
+            _values.fill(defaultInitValue);
+        }
+        else
+        {
+            std::size_t s = 1;
+
+            for (size_type i = 0; i < num_dimensions(); ++i)
+            {
+                const size_type k = TLayout == layout::last_axis_contiguous ? static_cast<size_type>(num_dimensions()) - 1 - i : i;
+
+                assert(_extents.extent(k) > 0 && "all sizes must be > 0");
+                _strides[k] = static_cast<size_type>(s);
+                s *= _extents.extent(k);
+            }
+
+            _values.assign(s, defaultInitValue);
+        }
+    }
+
+    void
+    fill(const value_type& value)
+    {
+        std::fill(_values.begin(), _values.end(), value);
+    }
+
+    void
+    swap(self_type& other) noexcept
+    {
+        std::swap(_extents, other._extents);
+        std::swap(_strides, other._strides);
+        std::swap(_values, other._values);
+    }
+}; // class basic_grid
+} // namespace nd
+
+#endif //__ND_BASIC_GRID_H__x5c9v3b7n1m5q9w3e7r1t5y9u3i7o1
@@ -0,0 +1,836 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_BITGRID_H__z3x7c1v5b9n3m7l1k5j9h3g7f1d5s9
+#define __ND_BITGRID_H__z3x7c1v5b9n3m7l1k5j9h3g7f1d5s9
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+  #include <intrin.h>
+#endif
+
+#include "grid.h"
+#include "parallel.h"
+
+//====================================================================================================
+//===== class bitgrid
+//====================================================================================================
+/*
+ * N-dimensional boolean mask packed 64 values per word:
+ *
+ *     nd::bitgrid<3> fg(volume, [](float v) { return v > 0.5F; }); // from a predicate over a grid
+ *     nd::bitgrid<3> m = fg & ~roi;
+ *     m.shift(2, -1);                                            // m(x, y, z) = old m(x, y, z + 1)
+ *     const auto n = m.count();
+ *
+ * - each row along the last dimension starts at a new word; bit j of a word is row position (64 * word + j).
+ *   Bits beyond the row end are always 0, so whole-word operations (count, ==, &, |, ^) need no masking
+ * - logical operations, fill and compare are plain loops over words that the compiler vectorizes
+ * - shifts along the last dimension move bits within each row; shifts along other dimensions move whole rows
+ * - conversion from / to nd::grid processes rows in parallel since no two rows share a word
+ */
+namespace nd
+{
+namespace detail
+{
+[[nodiscard]] inline unsigned int
+popcount64(std::uint64_t x) noexcept
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_popcountll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<unsigned int>(__popcnt64(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<unsigned int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+//! index of the lowest set bit; x must not be 0
+[[nodiscard]] inline unsigned int
+countr_zero64(std::uint64_t x) noexcept
+{
+    assert(x != 0);
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long id = 0;
+    _BitScanForward64(&id, x);
+    return static_cast<unsigned int>(id);
+#else
+    return popcount64((x & (~x + 1)) - 1);
+#endif
+}
+} // namespace detail
+
+template<std::size_t TDimensions>
+class bitgrid
+{
+    //------------------------------------------------------------------------------------------------------
+    // assertions
+    //------------------------------------------------------------------------------------------------------
+    static_assert(TDimensions > 0, "template num dimension must be greater than 0");
+
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] static constexpr std::size_t
+    num_dimensions() noexcept
+    {
+        return TDimensions;
+    }
+
+    using self_type = bitgrid<TDimensions>;
+    using value_type = bool;
+    using word_type = std::uint64_t;
+    using data_container_type = std::vector<word_type>;
+    using size_type = unsigned int;
+    using difference_type = int;
+    using grid_id_type = std::array<size_type, TDimensions>;
+
+    static constexpr size_type word_bits = 64;
+
+    //! proxy for a single bit
+    class reference
+    {
+        friend class bitgrid;
+
+        word_type* _word;
+        word_type  _mask;
+
+        reference(word_type& word, word_type mask) noexcept :
+            _word(&word)
+            , _mask(mask)
+        {
+        }
+
+      public:
+        reference(const reference&) = default;
+
+        reference&
+        operator=(bool x) noexcept
+        {
+            if (x)
+            {
+                *_word |= _mask;
+            }
+            else
+            {
+                *_word &= ~_mask;
+            }
+
+            return *this;
+        }
+
+        reference&
+        operator=(const reference& other) noexcept
+        {
+            return *this = static_cast<bool>(other);
+        }
+
+        [[nodiscard]] operator bool() const noexcept
+        {
+            return (*_word & _mask) != 0;
+        }
+
+        void
+        flip() noexcept
+        {
+            *_word ^= _mask;
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    grid_id_type        _sizes{};
+    //! word offset per unit step in dimensions 0 .. N-2; the last entry is unused (bits within a row)
+    grid_id_type        _word_strides{};
+    size_type           _words_per_row = 0;
+    //! valid bits of the last word in each row
+    word_type           _last_word_mask = 0;
+    data_container_type _words;
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    bitgrid() = default;
+
+    bitgrid(const self_type&) = default;
+
+    bitgrid(self_type&&) noexcept = default;
+
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) == TDimensions && std::conjunction_v<std::is_integral<std::decay_t<TSizes>>...>>* = nullptr>
+    explicit bitgrid(TSizes... sizes)
+    {
+        resize({static_cast<size_type>(sizes)...}, false);
+    }
+
+    template<typename TIndex>
+    bitgrid(std::initializer_list<TIndex> sizes, bool defaultInitValue = false)
+    {
+        resize(sizes, defaultInitValue);
+    }
+
+    //! sets each bit to pred(value) of the corresponding grid value
+    /*!
+     * numThreads == 0 picks the number of threads from the hardware and the grid size.
+     */
+    template<typename T, layout TLayout, typename TPredicate>
+    bitgrid(const grid<T, TDimensions, TLayout>& g, TPredicate pred, unsigned int numThreads = 0)
+    {
+        if (g.empty())
+        {
+            return;
+        }
+
+        _resize_words(g.size().begin(), g.size().end());
+
+        const auto&     values     = g.data(); // not data().data(): std::vector<bool> has none
+        const size_type lastStride = g.stride(TDimensions - 1);
+
+        _for_each_row(numThreads, g.num_values() * sizeof(T), [&](size_type row, const grid_id_type& rowGid)
+        {
+            size_type lid = 0;
+
+            for (size_type k = 0; k + 1 < TDimensions; ++k)
+            {
+                lid += rowGid[k] * g.stride(k);
+            }
+
+            word_type* words = _words.data() + static_cast<std::size_t>(row) * _words_per_row;
+
+            for (size_type w = 0, x = 0; w < _words_per_row; ++w)
+            {
+                const size_type n    = std::min(word_bits, _sizes[TDimensions - 1] - x);
+                word_type       bits = 0;
+
+                for (size_type j = 0; j < n; ++j, ++x, lid += lastStride)
+                {
+                    bits |= static_cast<word_type>(static_cast<bool>(pred(values[lid]))) << j;
+                }
+
+                words[w] = bits;
+            }
+        });
+    }
+
+    //! sets each bit to (value != 0)
+    template<typename T, layout TLayout>
+    explicit bitgrid(const grid<T, TDimensions, TLayout>& g, unsigned int numThreads = 0) :
+        bitgrid(g, [](const T& x)
+        {
+            return x != T(0);
+        }, numThreads)
+    {
+    }
+
+    ~bitgrid() = default;
+
+    self_type&
+    operator=(const self_type&) = default;
+
+    self_type&
+    operator=(self_type&&) noexcept = default;
+
+    //------------------------------------------------------------------------------------------------------
+    // conversion
+    //------------------------------------------------------------------------------------------------------
+    //! dense grid with T(1) for set and T(0) for unset bits
+    template<typename T = unsigned char>
+    [[nodiscard]] grid<T, TDimensions>
+    to_grid(unsigned int numThreads = 0) const
+    {
+        grid<T, TDimensions> g;
+
+        if (empty())
+        {
+            return g;
+        }
+
+        g.resize(_sizes.begin(), _sizes.end(), T(0));
+
+        // std::vector<bool> packs values, i.e., rows may share words
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            numThreads = 1;
+        }
+
+        auto& values = g.data();
+
+        _for_each_row(numThreads, num_values() * sizeof(T), [&](size_type row, const grid_id_type&)
+        {
+            const word_type* words = _words.data() + static_cast<std::size_t>(row) * _words_per_row;
+            std::size_t      lid   = static_cast<std::size_t>(row) * _sizes[TDimensions - 1];
+
+            for (size_type x = 0; x < _sizes[TDimensions - 1]; ++x, ++lid)
+            {
+                values[lid] = static_cast<T>((words[x / word_bits] >> (x % word_bits)) & 1U);
+            }
+        });
+
+        return g;
+    }
+
+  private:
+    //! calls f(row, rowGid) for each row along the last dimension; only the first N-1 entries of rowGid are set
+    template<typename TFunction>
+    void
+    _for_each_row(unsigned int numThreads, std::size_t numBytes, TFunction&& f) const
+    {
+        const size_type numRows = num_rows();
+
+        numThreads = detail::num_threads(numThreads, numBytes);
+
+        detail::parallel_for_range(numThreads, numRows, [&](std::size_t first, std::size_t last)
+        {
+            grid_id_type rowGid{};
+            std::size_t  r = first;
+
+            for (size_type k = TDimensions - 1; k-- > 0;)
+            {
+                rowGid[k] = static_cast<size_type>(r % _sizes[k]);
+                r /= _sizes[k];
+            }
+
+            for (std::size_t row = first; row < last; ++row)
+            {
+                f(static_cast<size_type>(row), rowGid);
+
+                for (size_type k = TDimensions - 1; k-- > 0;)
+                {
+                    if (++rowGid[k] < _sizes[k])
+                    {
+                        break;
+                    }
+
+                    rowGid[k] = 0;
+                }
+            }
+        });
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // sizes
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] const grid_id_type&
+    size() const noexcept
+    {
+        return _sizes;
+    }
+
+    [[nodiscard]] size_type
+    size(size_type dimId) const
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _sizes[dimId];
+    }
+
+    [[nodiscard]] size_type
+    num_values() const noexcept
+    {
+        return _words.empty() ? 0U : num_rows() * _sizes[TDimensions - 1];
+    }
+
+    //! number of rows along the last dimension
+    [[nodiscard]] size_type
+    num_rows() const noexcept
+    {
+        return _words_per_row == 0 ? 0U : static_cast<size_type>(_words.size() / _words_per_row);
+    }
+
+    [[nodiscard]] size_type
+    words_per_row() const noexcept
+    {
+        return _words_per_row;
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return _words.empty();
+    }
+
+    [[nodiscard]] data_container_type&
+    data() noexcept
+    {
+        return _words;
+    }
+
+    [[nodiscard]] const data_container_type&
+    data() const noexcept
+    {
+        return _words;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // access
+    //------------------------------------------------------------------------------------------------------
+  private:
+    //! word id and bit id of a grid position
+    template<typename TIndexAccessible>
+    [[nodiscard]] std::pair<std::size_t, size_type>
+    _locate(const TIndexAccessible& gid) const noexcept
+    {
+        std::size_t wid = 0;
+
+        for (size_type k = 0; k + 1 < TDimensions; ++k)
+        {
+            assert(static_cast<size_type>(gid[k]) < _sizes[k] && "id out of bounds");
+            wid += static_cast<std::size_t>(gid[k]) * _word_strides[k];
+        }
+
+        const auto x = static_cast<size_type>(gid[TDimensions - 1]);
+        assert(x < _sizes[TDimensions - 1] && "id out of bounds");
+
+        return {wid + x / word_bits, x % word_bits};
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] std::pair<std::size_t, size_type>
+    _locate_ids(const Ids& ... ids) const noexcept
+    {
+        constexpr bool isIndexPack = sizeof...(Ids) == TDimensions && std::conjunction_v<std::is_integral<Ids>...>;
+
+        static_assert(isIndexPack || sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+        if constexpr (isIndexPack)
+        {
+            return _locate(grid_id_type{static_cast<size_type>(ids)...});
+        }
+        else
+        {
+            return _locate(std::get<0>(std::forward_as_tuple(ids...)));
+        }
+    }
+
+  public:
+    template<typename... Ids>
+    [[nodiscard]] bool
+    operator()(const Ids& ... ids) const noexcept
+    {
+        const auto [wid, bit] = _locate_ids(ids...);
+        return (_words[wid] >> bit) & 1U;
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] reference
+    operator()(const Ids& ... ids) noexcept
+    {
+        const auto [wid, bit] = _locate_ids(ids...);
+        return reference(_words[wid], word_type(1) << bit);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // queries
+    //------------------------------------------------------------------------------------------------------
+    //! number of set bits
+    [[nodiscard]] std::size_t
+    count() const noexcept
+    {
+        std::size_t n = 0;
+
+        for (const word_type w: _words)
+        {
+            n += detail::popcount64(w);
+        }
+
+        return n;
+    }
+
+    [[nodiscard]] bool
+    any() const noexcept
+    {
+        return std::any_of(_words.begin(), _words.end(), [](word_type w)
+        {
+            return w != 0;
+        });
+    }
+
+    [[nodiscard]] bool
+    none() const noexcept
+    {
+        return !any();
+    }
+
+    [[nodiscard]] bool
+    all() const noexcept
+    {
+        for (std::size_t w = 0; w < _words.size(); w += _words_per_row)
+        {
+            for (size_type k = 0; k + 1 < _words_per_row; ++k)
+            {
+                if (_words[w + k] != ~word_type(0))
+                {
+                    return false;
+                }
+            }
+
+            if (_words[w + _words_per_row - 1] != _last_word_mask)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool
+    operator==(const self_type& other) const noexcept
+    {
+        return _sizes == other._sizes && _words == other._words;
+    }
+
+    [[nodiscard]] bool
+    operator!=(const self_type& other) const noexcept
+    {
+        return !operator==(other);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // logical operations
+    //------------------------------------------------------------------------------------------------------
+  private:
+    template<typename TFunction>
+    self_type&
+    _apply(const self_type& other, TFunction f) noexcept
+    {
+        assert(_sizes == other._sizes && "sizes must match");
+
+        word_type* __restrict       a = _words.data();
+        const word_type* __restrict b = other._words.data();
+        const std::size_t           n = _words.size();
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a[i] = f(a[i], b[i]);
+        }
+
+        return *this;
+    }
+
+  public:
+    self_type&
+    operator&=(const self_type& other) noexcept
+    {
+        return _apply(other, [](word_type a, word_type b)
+        {
+            return a & b;
+        });
+    }
+
+    self_type&
+    operator|=(const self_type& other) noexcept
+    {
+        return _apply(other, [](word_type a, word_type b)
+        {
+            return a | b;
+        });
+    }
+
+    self_type&
+    operator^=(const self_type& other) noexcept
+    {
+        return _apply(other, [](word_type a, word_type b)
+        {
+            return a ^ b;
+        });
+    }
+
+    //! clears the bits that are set in other (this & ~other)
+    self_type&
+    subtract(const self_type& other) noexcept
+    {
+        return _apply(other, [](word_type a, word_type b)
+        {
+            return a & ~b;
+        });
+    }
+
+    [[nodiscard]] self_type
+    operator&(const self_type& other) const
+    {
+        return self_type(*this) &= other;
+    }
+
+    [[nodiscard]] self_type
+    operator|(const self_type& other) const
+    {
+        return self_type(*this) |= other;
+    }
+
+    [[nodiscard]] self_type
+    operator^(const self_type& other) const
+    {
+        return self_type(*this) ^= other;
+    }
+
+    [[nodiscard]] self_type
+    operator~() const
+    {
+        return self_type(*this).flip();
+    }
+
+    //! inverts all bits
+    self_type&
+    flip() noexcept
+    {
+        for (word_type& w: _words)
+        {
+            w = ~w;
+        }
+
+        _clear_padding();
+        return *this;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // shift
+    //------------------------------------------------------------------------------------------------------
+    //! moves all bits by delta along dimension dimId: new(.., x + delta, ..) = old(.., x, ..); vacated bits are 0
+    self_type&
+    shift(size_type dimId, difference_type delta) noexcept
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+
+        if (delta == 0 || empty())
+        {
+            return *this;
+        }
+
+        const size_type offset = static_cast<size_type>(delta < 0 ? -delta : delta);
+
+        if (offset >= _sizes[dimId])
+        {
+            std::fill(_words.begin(), _words.end(), word_type(0));
+            return *this;
+        }
+
+        if (dimId + 1 == TDimensions)
+        {
+            for (std::size_t w = 0; w < _words.size(); w += _words_per_row)
+            {
+                if (delta > 0)
+                {
+                    _shift_row_up(_words.data() + w, offset);
+                }
+                else
+                {
+                    _shift_row_down(_words.data() + w, offset);
+                }
+            }
+
+            _clear_padding();
+        }
+        else
+        {
+            const std::size_t block = static_cast<std::size_t>(_sizes[dimId]) * _word_strides[dimId];
+            const std::size_t off   = static_cast<std::size_t>(offset) * _word_strides[dimId];
+
+            for (auto first = _words.begin(); first != _words.end(); first += static_cast<difference_type>(block))
+            {
+                const auto last = first + static_cast<difference_type>(block);
+
+                if (delta > 0)
+                {
+                    std::copy_backward(first, last - static_cast<difference_type>(off), last);
+                    std::fill(first, first + static_cast<difference_type>(off), word_type(0));
+                }
+                else
+                {
+                    std::copy(first + static_cast<difference_type>(off), last, first);
+                    std::fill(last - static_cast<difference_type>(off), last, word_type(0));
+                }
+            }
+        }
+
+        return *this;
+    }
+
+  private:
+    //! row bit x moves to x + offset
+    void
+    _shift_row_up(word_type* row, size_type offset) const noexcept
+    {
+        const size_type q = offset / word_bits;
+        const size_type r = offset % word_bits;
+
+        for (size_type w = _words_per_row; w-- > 0;)
+        {
+            word_type v = 0;
+
+            if (w >= q)
+            {
+                v = row[w - q] << r;
+
+                if (r != 0 && w >= q + 1)
+                {
+                    v |= row[w - q - 1] >> (word_bits - r);
+                }
+            }
+
+            row[w] = v;
+        }
+    }
+
+    //! row bit x moves to x - offset
+    void
+    _shift_row_down(word_type* row, size_type offset) const noexcept
+    {
+        const size_type q = offset / word_bits;
+        const size_type r = offset % word_bits;
+
+        for (size_type w = 0; w < _words_per_row; ++w)
+        {
+            word_type v = 0;
+
+            if (w + q < _words_per_row)
+            {
+                v = row[w + q] >> r;
+
+                if (r != 0 && w + q + 1 < _words_per_row)
+                {
+                    v |= row[w + q + 1] << (word_bits - r);
+                }
+            }
+
+            row[w] = v;
+        }
+    }
+
+    void
+    _clear_padding() noexcept
+    {
+        if (_last_word_mask == ~word_type(0))
+        {
+            return;
+        }
+
+        for (std::size_t w = _words_per_row - 1; w < _words.size(); w += _words_per_row)
+        {
+            _words[w] &= _last_word_mask;
+        }
+    }
+
+    //====================================================================================================
+    //===== SETTER
+    //====================================================================================================
+    template<typename TForwardIterator>
+    void
+    _resize_words(TForwardIterator first, TForwardIterator last)
+    {
+        std::copy(first, last, _sizes.begin());
+        assert(std::all_of(_sizes.begin(), _sizes.end(), [](size_type x)
+        {
+            return x > 0;
+        }) && "all sizes must be > 0");
+
+        const size_type rowLength = _sizes[TDimensions - 1];
+        const size_type tail      = rowLength % word_bits;
+
+        _words_per_row  = (rowLength + word_bits - 1) / word_bits;
+        _last_word_mask = tail == 0 ? ~word_type(0) : (word_type(1) << tail) - 1;
+
+        std::size_t s = _words_per_row;
+        _word_strides[TDimensions - 1] = 0;
+
+        for (size_type k = TDimensions - 1; k-- > 0;)
+        {
+            _word_strides[k] = static_cast<size_type>(s);
+            s *= _sizes[k];
+        }
+
+        _words.assign(s, word_type(0));
+    }
+
+  public:
+    template<typename T>
+    void
+    resize(std::initializer_list<T> sizes, bool defaultInitValue = false)
+    {
+        assert(sizes.size() == num_dimensions() && "invalid number or sizes in initializer list");
+        resize(sizes.begin(), sizes.end(), defaultInitValue);
+    }
+
+    //! sets new sizes; all bits are set to defaultInitValue
+    template<typename TForwardIterator, std::enable_if_t<!std::is_arithmetic_v<std::decay_t<TForwardIterator>>>* = nullptr>
+    void
+    resize(TForwardIterator first, TForwardIterator last, bool defaultInitValue = false)
+    {
+        _resize_words(first, last);
+        fill(defaultInitValue);
+    }
+
+    void
+    clear()
+    {
+        _sizes.fill(0);
+        _word_strides.fill(0);
+        _words_per_row  = 0;
+        _last_word_mask = 0;
+        _words.clear();
+    }
+
+    void
+    fill(bool value) noexcept
+    {
+        std::fill(_words.begin(), _words.end(), value ? ~word_type(0) : word_type(0));
+
+        if (value)
+        {
+            _clear_padding();
+        }
+    }
+
+    void
+    swap(self_type& other) noexcept
+    {
+        std::swap(_sizes, other._sizes);
+        std::swap(_word_strides, other._word_strides);
+        std::swap(_words_per_row, other._words_per_row);
+        std::swap(_last_word_mask, other._last_word_mask);
+        std::swap(_words, other._words);
+    }
+}; // class bitgrid
+} // namespace nd
+
+#endif //__ND_BITGRID_H__z3x7c1v5b9n3m7l1k5j9h3g7f1d5s9
@@ -0,0 +1,348 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#ifndef __ND_CHARCONV_H__k2j6h0g4f8d2s6a0p4o8i2u6y0t4r8
+#define __ND_CHARCONV_H__k2j6h0g4f8d2s6a0p4o8i2u6y0t4r8
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+//====================================================================================================
+//===== to_string / from_string helpers
+//====================================================================================================
+/*
+ * value formatting and parsing shared by the to_string() / from_string() of nd::array, nd::grid and nd::vector:
+ *
+ *     [v, v, ...]                   1D
+ *     [[v, v, ...] [v, v, ...] ...] 2D, each text row runs along dimension 0
+ *     [(i,j,k)=v, ...]              3D+, last dimension running fastest
+ */
+namespace nd
+{
+namespace detail
+{
+//! value types that are written / read via std::to_chars / std::from_chars
+/*!
+ * bool and character types are excluded since streams print them as 0/1 and as characters, respectively
+ */
+template<typename TValue>
+[[nodiscard]] constexpr bool
+has_charconv() noexcept
+{
+    using T = std::remove_cv_t<TValue>;
+
+    return std::is_floating_point_v<T>
+           || (std::is_integral_v<T>
+               && !std::is_same_v<T, bool>
+               && !std::is_same_v<T, char>
+               && !std::is_same_v<T, signed char>
+               && !std::is_same_v<T, unsigned char>
+               && !std::is_same_v<T, wchar_t>
+               && !std::is_same_v<T, char16_t>
+               && !std::is_same_v<T, char32_t>);
+}
+
+//------------------------------------------------------------------------------------------------------
+// to string
+//------------------------------------------------------------------------------------------------------
+template<typename TValue>
+void
+append_value(std::string& s, const TValue& x)
+{
+    if constexpr (has_charconv<TValue>())
+    {
+        char buf[64];
+        s.append(buf, std::to_chars(buf, buf + sizeof(buf), x).ptr);
+    }
+    else if constexpr (std::is_same_v<std::remove_cv_t<TValue>, bool>)
+    {
+        s += x ? '1' : '0';
+    }
+    else
+    {
+        std::ostringstream o;
+        o << x;
+        s += o.str();
+    }
+}
+
+inline void
+append_index(std::string& s, std::size_t i)
+{
+    char buf[24];
+    s.append(buf, std::to_chars(buf, buf + sizeof(buf), i).ptr);
+}
+
+//------------------------------------------------------------------------------------------------------
+// from string
+//------------------------------------------------------------------------------------------------------
+inline void
+skip_whitespace(const char*& p, const char* end) noexcept
+{
+    while (p != end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t'))
+    {
+        ++p;
+    }
+}
+
+[[nodiscard]] inline bool
+consume(const char*& p, const char* end, char c) noexcept
+{
+    skip_whitespace(p, end);
+
+    if (p != end && *p == c)
+    {
+        ++p;
+        return true;
+    }
+
+    return false;
+}
+
+inline void
+expect(const char*& p, const char* end, char c)
+{
+    if (!consume(p, end, c))
+    {
+        throw std::invalid_argument(std::string("from_string: expected '") + c + "'");
+    }
+}
+
+template<typename T>
+void
+parse_number(const char*& p, const char* end, T& x)
+{
+    skip_whitespace(p, end);
+
+    if constexpr (std::is_same_v<std::remove_cv_t<T>, bool>)
+    {
+        if (p == end || (*p != '0' && *p != '1'))
+        {
+            throw std::invalid_argument("from_string: invalid value");
+        }
+
+        x = *p++ == '1';
+    }
+    else
+    {
+        const auto res = std::from_chars(p, end, x);
+
+        if (res.ec != std::errc())
+        {
+            throw std::invalid_argument("from_string: invalid value");
+        }
+
+        p = res.ptr;
+    }
+}
+
+//! parses the output of to_string()
+/*!
+ * sizes are derived from the text; values are returned in text order,
+ * i.e., 1D / 3D+ with the last dimension running fastest and 2D with text rows running along dimension 0
+ */
+template<typename TValue, typename TSize>
+void
+parse_string(std::string_view str, std::vector<TSize>& sizes, std::vector<TValue>& values)
+{
+    static_assert(has_charconv<TValue>() || std::is_same_v<std::remove_cv_t<TValue>, bool>, "from_string() requires an arithmetic value type");
+
+    const char* p   = str.data();
+    const char* end = p + str.size();
+
+    sizes.clear();
+    values.clear();
+
+    const auto parseValue = [&]()
+    {
+        TValue x{};
+        parse_number(p, end, x);
+        values.push_back(x);
+    };
+
+    expect(p, end, '[');
+
+    if (consume(p, end, ']'))
+    { /* empty */ }
+    else if (consume(p, end, '['))
+    {
+        // 2D: [[v, v, ...] [v, v, ...] ...]
+        TSize numRows = 0;
+        TSize numCols = 0;
+
+        do
+        {
+            const std::size_t n0 = values.size();
+
+            do
+            { parseValue(); } while (consume(p, end, ','));
+
+            expect(p, end, ']');
+
+            const auto n = static_cast<TSize>(values.size() - n0);
+            if (numRows != 0 && n != numCols)
+            {
+                throw std::invalid_argument("from_string: rows have different lengths");
+            }
+
+            numCols = n;
+            ++numRows;
+        } while (consume(p, end, '['));
+
+        expect(p, end, ']');
+
+        sizes = {numCols, numRows};
+    }
+    else if (consume(p, end, '('))
+    {
+        // 3D+: [(i,j,k)=v, ...] in list order, i.e., each id follows the previous one with the last dimension running fastest;
+        // a dimension's size is known once it wraps around to 0 (or from the last id), later ids must agree with it
+        std::vector<TSize> gid;
+        std::vector<TSize> prev;
+
+        const auto invalidOrder = []()
+        {
+            throw std::invalid_argument("from_string: grid ids are not in list order");
+        };
+
+        for (bool first = true;; first = false)
+        {
+            if (!first)
+            {
+                expect(p, end, '(');
+            }
+
+            gid.clear();
+
+            do
+            {
+                TSize i = 0;
+                parse_number(p, end, i);
+                gid.push_back(i);
+            } while (consume(p, end, ','));
+
+            expect(p, end, ')');
+            expect(p, end, '=');
+
+            if (first)
+            {
+                // sizes of 0 are not known yet
+                sizes.assign(gid.size(), 0);
+
+                if (std::any_of(gid.begin(), gid.end(), [](TSize i) { return i != 0; }))
+                {
+                    invalidOrder();
+                }
+            }
+            else
+            {
+                if (gid.size() != sizes.size())
+                {
+                    throw std::invalid_argument("from_string: inconsistent number of dimensions");
+                }
+
+                // k: the dimension that is incremented; all dimensions after it wrap around to 0
+                std::size_t k = 0;
+                while (k < gid.size() && gid[k] == prev[k])
+                { ++k; }
+
+                if (k == gid.size() || gid[k] != prev[k] + 1 || (sizes[k] != 0 && gid[k] >= sizes[k]))
+                {
+                    invalidOrder();
+                }
+
+                for (std::size_t j = k + 1; j < gid.size(); ++j)
+                {
+                    if (gid[j] != 0 || (sizes[j] != 0 && sizes[j] != prev[j] + 1))
+                    {
+                        invalidOrder();
+                    }
+
+                    sizes[j] = prev[j] + 1;
+                }
+            }
+
+            prev.swap(gid);
+            parseValue();
+
+            if (!consume(p, end, ','))
+            {
+                break;
+            }
+        }
+
+        expect(p, end, ']');
+
+        // the last id is the largest in every dimension
+        for (std::size_t i = 0; i < prev.size(); ++i)
+        {
+            if (sizes[i] != 0 && sizes[i] != prev[i] + 1)
+            {
+                invalidOrder();
+            }
+
+            sizes[i] = prev[i] + 1;
+        }
+    }
+    else
+    {
+        // 1D: [v, v, ...]
+        do
+        { parseValue(); } while (consume(p, end, ','));
+
+        expect(p, end, ']');
+
+        sizes = {static_cast<TSize>(values.size())};
+    }
+
+    skip_whitespace(p, end);
+
+    if (p != end)
+    {
+        throw std::invalid_argument("from_string: unexpected characters after closing bracket");
+    }
+
+    const std::size_t n = std::accumulate(sizes.begin(), sizes.end(), std::size_t(sizes.empty() ? 0 : 1), [](std::size_t x, TSize y)
+    {
+        return x * y;
+    });
+
+    if (n != values.size())
+    {
+        throw std::invalid_argument("from_string: number of values does not match the sizes");
+    }
+}
+} // namespace detail
+} // namespace nd
+
+#endif //__ND_CHARCONV_H__k2j6h0g4f8d2s6a0p4o8i2u6y0t4r8
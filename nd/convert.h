@@ -0,0 +1,76 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_CONVERT_H__t4y8u2i6o0p4a8s2d6f0g4h8j2k6l0
+#define __ND_CONVERT_H__t4y8u2i6o0p4a8s2d6f0g4h8j2k6l0
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace nd
+{
+namespace detail
+{
+//! bulk value conversion used by the converting constructors, assignments and cast() of the containers
+/*!
+ * specialize for pairs of types with a faster (e.g., SIMD) conversion than element-wise static_cast
+ */
+template<typename TFrom, typename TTo, typename = void>
+struct value_converter
+{
+    static void
+    convert(const TFrom* src, std::size_t n, TTo* dst)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            dst[i] = static_cast<TTo>(src[i]);
+        }
+    }
+};
+
+//! dst[i] = src[i] for i < src.size(); dst must have at least src.size() values
+template<typename TFrom, typename TTo>
+void
+convert_values(const std::vector<TFrom>& src, std::vector<TTo>& dst)
+{
+    if constexpr (std::is_same_v<TFrom, bool> || std::is_same_v<TTo, bool>)
+    {
+        std::transform(src.begin(), src.end(), dst.begin(), [](const TFrom& x)
+        {
+            return static_cast<TTo>(x);
+        });
+    }
+    else
+    {
+        value_converter<TFrom, TTo>::convert(src.data(), src.size(), dst.data());
+    }
+}
+} // namespace detail
+} // namespace nd
+
+#endif //__ND_CONVERT_H__t4y8u2i6o0p4a8s2d6f0g4h8j2k6l0
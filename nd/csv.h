@@ -0,0 +1,414 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_CSV_H__d8f3k2m9x0q1w7e5r4t6y8u2i3o9p0
+#define __ND_CSV_H__d8f3k2m9x0q1w7e5r4t6y8u2i3o9p0
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define ND_CSV_MMAP
+#endif
+
+#include "grid.h"
+#include "parallel.h"
+
+//====================================================================================================
+//===== csv / tsv import and export for nd::grid<T, 2>
+//====================================================================================================
+/*
+ * - row r, column c of the file is stored at grid(r, c), i.e., rows are contiguous in memory
+ * - the file is split at line boundaries and each thread parses its lines directly into the grid's buffer
+ * - empty lines are skipped
+ */
+namespace nd
+{
+namespace detail
+{
+//! read-only view of a whole file; memory-mapped where available
+class csv_file
+{
+  private:
+    const char*       _data = nullptr;
+    std::size_t       _size = 0;
+    std::vector<char> _buffer; // used if mmap is not available
+#ifdef ND_CSV_MMAP
+    void* _map = nullptr;
+#endif
+
+  public:
+    explicit csv_file(const std::string& path)
+    {
+#ifdef ND_CSV_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("read_csv: cannot open file \"" + path + "\"");
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("read_csv: cannot stat file \"" + path + "\"");
+        }
+
+        _size = static_cast<std::size_t>(st.st_size);
+
+        if (_size != 0)
+        {
+            _map = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (_map == MAP_FAILED)
+            {
+                _map = nullptr;
+                ::close(fd);
+                throw std::runtime_error("read_csv: cannot map file \"" + path + "\"");
+            }
+
+            ::madvise(_map, _size, MADV_SEQUENTIAL);
+            _data = static_cast<const char*>(_map);
+        }
+
+        ::close(fd);
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.good())
+        {
+            throw std::runtime_error("read_csv: cannot open file \"" + path + "\"");
+        }
+
+        _buffer.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+
+        _data = _buffer.data();
+        _size = _buffer.size();
+#endif
+    }
+
+    csv_file(const csv_file&) = delete;
+    csv_file& operator=(const csv_file&) = delete;
+
+    ~csv_file()
+    {
+#ifdef ND_CSV_MMAP
+        if (_map != nullptr)
+        {
+            ::munmap(_map, _size);
+        }
+#endif
+    }
+
+    [[nodiscard]] const char*
+    begin() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] const char*
+    end() const noexcept
+    {
+        return _data + _size;
+    }
+
+    [[nodiscard]] std::size_t
+    size() const noexcept
+    {
+        return _size;
+    }
+};
+
+//! [first, last) without trailing '\r'; returns false for empty lines
+[[nodiscard]] inline bool
+csv_next_line(const char*& p, const char* end, const char*& first, const char*& last) noexcept
+{
+    while (p != end)
+    {
+        first = p;
+
+        const void* nl = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+        last = nl != nullptr ? static_cast<const char*>(nl) : end;
+        p    = nl != nullptr ? last + 1 : end;
+
+        if (last != first && last[-1] == '\r')
+        {
+            --last;
+        }
+
+        if (last != first)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+} // namespace detail
+
+//------------------------------------------------------------------------------------------------------
+// read csv
+//------------------------------------------------------------------------------------------------------
+//! reads a delimiter-separated file of numbers into a grid of size (num rows, num columns)
+/*!
+ * numColumns == 0 infers the number of columns from the first line; otherwise it is validated.
+ * numThreads == 0 picks the number of threads from the hardware and the file size.
+ * Throws std::runtime_error if the file cannot be read or is malformed.
+ */
+template<typename TValue>
+[[nodiscard]] grid<TValue, 2>
+read_csv(const std::string& path, char delimiter = ',', unsigned int numColumns = 0, unsigned int numThreads = 0)
+{
+    static_assert(std::is_arithmetic_v<TValue> && !std::is_same_v<TValue, bool>, "read_csv() requires an arithmetic value type");
+
+    using size_type = typename grid<TValue, 2>::size_type;
+
+    const detail::csv_file file(path);
+
+    grid<TValue, 2> res;
+
+    //------------------------------------------------------------------------------------------------------
+    // number of columns from the first non-empty line
+    //------------------------------------------------------------------------------------------------------
+    const char* p = file.begin();
+    const char* first;
+    const char* last;
+
+    if (!detail::csv_next_line(p, file.end(), first, last))
+    {
+        if (numColumns != 0)
+        {
+            throw std::runtime_error("read_csv: file \"" + path + "\" is empty");
+        }
+
+        return res;
+    }
+
+    const auto numColumnsInFile = static_cast<size_type>(std::count(first, last, delimiter) + 1);
+    if (numColumns != 0 && numColumns != numColumnsInFile)
+    {
+        throw std::runtime_error("read_csv: expected " + std::to_string(numColumns) + " columns but found " + std::to_string(numColumnsInFile));
+    }
+
+    numColumns = numColumnsInFile;
+
+    //------------------------------------------------------------------------------------------------------
+    // split at line boundaries
+    //------------------------------------------------------------------------------------------------------
+    numThreads = detail::num_threads(numThreads, file.size());
+
+    std::vector<const char*> chunks(numThreads + 1, file.end());
+    chunks[0] = file.begin();
+
+    for (unsigned int t = 1; t < numThreads; ++t)
+    {
+        const char* c = std::max(chunks[t - 1], file.begin() + file.size() / numThreads * t);
+
+        if (c != file.begin() && c != file.end() && c[-1] != '\n')
+        {
+            const void* nl = std::memchr(c, '\n', static_cast<std::size_t>(file.end() - c));
+            c = nl != nullptr ? static_cast<const char*>(nl) + 1 : file.end();
+        }
+
+        chunks[t] = c;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // pass 1: count rows per chunk
+    //------------------------------------------------------------------------------------------------------
+    std::vector<size_type> firstRow(numThreads + 1, 0);
+
+    detail::parallel_for(numThreads, [&](unsigned int t)
+    {
+        const char* q = chunks[t];
+        const char* f;
+        const char* l;
+        size_type   n = 0;
+
+        while (detail::csv_next_line(q, chunks[t + 1], f, l))
+        { ++n; }
+
+        firstRow[t + 1] = n;
+    });
+
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        firstRow[t + 1] += firstRow[t];
+    }
+
+    res.resize(firstRow[numThreads], numColumns);
+
+    //------------------------------------------------------------------------------------------------------
+    // pass 2: parse directly into the grid
+    //------------------------------------------------------------------------------------------------------
+    TValue* values = res.data().data();
+
+    detail::parallel_for(numThreads, [&](unsigned int t)
+    {
+        const char* q = chunks[t];
+        const char* f;
+        const char* l;
+        size_type   row = firstRow[t];
+
+        const auto fail = [&]()
+        {
+            throw std::runtime_error("read_csv: invalid value or number of columns in row " + std::to_string(row));
+        };
+
+        while (detail::csv_next_line(q, chunks[t + 1], f, l))
+        {
+            TValue* out = values + static_cast<std::size_t>(row) * numColumns;
+
+            for (size_type c = 0; c < numColumns; ++c)
+            {
+                while (f != l && (*f == ' ' || *f == '\t') && *f != delimiter)
+                { ++f; }
+
+                const auto r = std::from_chars(f, l, out[c]);
+                if (r.ec != std::errc())
+                {
+                    fail();
+                }
+
+                f = r.ptr;
+
+                while (f != l && (*f == ' ' || *f == '\t') && *f != delimiter)
+                { ++f; }
+
+                if (c + 1 < numColumns)
+                {
+                    if (f == l || *f != delimiter)
+                    {
+                        fail();
+                    }
+
+                    ++f;
+                }
+            }
+
+            if (f != l)
+            {
+                fail();
+            }
+
+            ++row;
+        }
+    });
+
+    return res;
+}
+
+//------------------------------------------------------------------------------------------------------
+// write csv
+//------------------------------------------------------------------------------------------------------
+//! writes grid(r, c) as row r, column c; rows are formatted in parallel
+/*!
+ * numThreads == 0 picks the number of threads from the hardware and the grid size.
+ * Throws std::runtime_error if the file cannot be written.
+ */
+template<typename TValue>
+void
+write_csv(const std::string& path, const grid<TValue, 2>& g, char delimiter = ',', unsigned int numThreads = 0)
+{
+    static_assert(std::is_arithmetic_v<TValue> && !std::is_same_v<TValue, bool>, "write_csv() requires an arithmetic value type");
+
+    using size_type = typename grid<TValue, 2>::size_type;
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.good())
+    {
+        throw std::runtime_error("write_csv: cannot open file \"" + path + "\"");
+    }
+
+    if (g.empty())
+    {
+        return;
+    }
+
+    const size_type numRows    = g.size(0);
+    const size_type numColumns = g.size(1);
+
+    constexpr std::size_t charsPerValue = std::is_floating_point_v<TValue> ? 16U : 8U;
+    numThreads = detail::num_threads(numThreads, static_cast<std::size_t>(g.num_values()) * charsPerValue);
+    numThreads = std::min<unsigned int>(numThreads, numRows);
+
+    // each thread formats a block of rows into its own buffer; blocks are written in order
+    std::vector<std::string> blocks(numThreads);
+    const TValue*            values = g.data().data();
+
+    detail::parallel_for(numThreads, [&](unsigned int t)
+    {
+        const size_type rowBegin = static_cast<size_type>(static_cast<std::size_t>(numRows) * t / numThreads);
+        const size_type rowEnd   = static_cast<size_type>(static_cast<std::size_t>(numRows) * (t + 1) / numThreads);
+
+        std::string& s = blocks[t];
+        s.reserve(static_cast<std::size_t>(rowEnd - rowBegin) * numColumns * charsPerValue);
+
+        char buf[64];
+
+        for (size_type r = rowBegin; r < rowEnd; ++r)
+        {
+            const TValue* row = values + static_cast<std::size_t>(r) * numColumns;
+
+            for (size_type c = 0; c < numColumns; ++c)
+            {
+                if (c != 0)
+                {
+                    s += delimiter;
+                }
+
+                s.append(buf, std::to_chars(buf, buf + sizeof(buf), row[c]).ptr);
+            }
+
+            s += '\n';
+        }
+    });
+
+    for (const std::string& s: blocks)
+    {
+        file.write(s.data(), static_cast<std::streamsize>(s.size()));
+    }
+
+    if (!file.good())
+    {
+        throw std::runtime_error("write_csv: cannot write file \"" + path + "\"");
+    }
+}
+} // namespace nd
+
+#endif //__ND_CSV_H__d8f3k2m9x0q1w7e5r4t6y8u2i3o9p0
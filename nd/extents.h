@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_EXTENTS_H__k7j1h5g9f3d7s1a5p9o3i7u1y5t9r3
+#define __ND_EXTENTS_H__k7j1h5g9f3d7s1a5p9o3i7u1y5t9r3
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+//====================================================================================================
+//===== extents
+//====================================================================================================
+/*
+ * per-dimension sizes that are either fixed at compile time or set at run time (nd::dyn):
+ *
+ *     nd::extents<nd::dyn, nd::dyn, 3> e(480, 640); // run-time height and width, 3 channels
+ *     e.extent(2);                                  // 3, folded at compile time via static_extent(2)
+ *
+ * only the dynamic extents are stored
+ */
+namespace nd
+{
+//! marks a dimension whose size is set at run time
+inline constexpr std::size_t dyn = std::numeric_limits<std::size_t>::max();
+
+template<std::size_t... TExtents>
+class extents
+{
+    static_assert(sizeof...(TExtents) > 0, "at least one extent is required");
+    static_assert(((TExtents > 0) && ...), "static extents must be greater than 0");
+
+  public:
+    using size_type = unsigned int;
+
+    [[nodiscard]] static constexpr std::size_t
+    rank() noexcept
+    {
+        return sizeof...(TExtents);
+    }
+
+    [[nodiscard]] static constexpr std::size_t
+    rank_dynamic() noexcept
+    {
+        return ((TExtents == dyn ? 1 : 0) + ...);
+    }
+
+    //! compile-time extent of dimension k; nd::dyn for run-time extents
+    [[nodiscard]] static constexpr std::size_t
+    static_extent(std::size_t k) noexcept
+    {
+        constexpr std::size_t e[] = {TExtents...};
+        return e[k];
+    }
+
+    //! product of all extents; nd::dyn if any extent is dynamic
+    [[nodiscard]] static constexpr std::size_t
+    static_num_values() noexcept
+    {
+        return rank_dynamic() == 0 ? (TExtents * ...) : dyn;
+    }
+
+  private:
+    //! position of dimension k among the dynamic extents
+    [[nodiscard]] static constexpr std::size_t
+    _dynamic_index(std::size_t k) noexcept
+    {
+        std::size_t n = 0;
+
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            n += static_extent(i) == dyn;
+        }
+
+        return n;
+    }
+
+    std::array<size_type, rank_dynamic()> _dynamic{};
+
+  public:
+    constexpr extents() = default;
+
+    //! the dynamic extents in dimension order
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) == rank_dynamic() && sizeof...(TSizes) != 0 && std::conjunction_v<std::is_integral<TSizes>...>>* = nullptr>
+    constexpr explicit extents(TSizes... dynamicSizes) noexcept :
+        _dynamic{static_cast<size_type>(dynamicSizes)...}
+    {
+    }
+
+    //! all extents; the static ones must match
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) == rank() && rank() != rank_dynamic() && std::conjunction_v<std::is_integral<TSizes>...>>* = nullptr>
+    constexpr explicit extents(TSizes... sizes) noexcept
+    {
+        const std::array<size_type, rank()> all{static_cast<size_type>(sizes)...};
+
+        for (std::size_t k = 0; k < rank(); ++k)
+        {
+            if (static_extent(k) == dyn)
+            {
+                _dynamic[_dynamic_index(k)] = all[k];
+            }
+            else
+            {
+                assert(all[k] == static_extent(k) && "size does not match static extent");
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr size_type
+    extent(std::size_t k) const noexcept
+    {
+        assert(k < rank() && "k exceeds rank()");
+
+        if constexpr (rank_dynamic() == 0)
+        {
+            return static_cast<size_type>(static_extent(k));
+        }
+        else
+        {
+            return static_extent(k) == dyn ? _dynamic[_dynamic_index(k)] : static_cast<size_type>(static_extent(k));
+        }
+    }
+
+    //! extent of dimension K; a constant for static extents
+    template<std::size_t K>
+    [[nodiscard]] constexpr size_type
+    extent() const noexcept
+    {
+        static_assert(K < rank(), "K exceeds rank()");
+
+        if constexpr (static_extent(K) != dyn)
+        {
+            return static_cast<size_type>(static_extent(K));
+        }
+        else
+        {
+            return _dynamic[_dynamic_index(K)];
+        }
+    }
+
+    [[nodiscard]] constexpr std::array<size_type, rank()>
+    sizes() const noexcept
+    {
+        std::array<size_type, rank()> s{};
+
+        for (std::size_t k = 0; k < rank(); ++k)
+        {
+            s[k] = extent(k);
+        }
+
+        return s;
+    }
+
+    [[nodiscard]] constexpr bool
+    operator==(const extents& other) const noexcept
+    {
+        for (std::size_t i = 0; i < rank_dynamic(); ++i)
+        {
+            if (_dynamic[i] != other._dynamic[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] constexpr bool
+    operator!=(const extents& other) const noexcept
+    {
+        return !operator==(other);
+    }
+};
+} // namespace nd
+
+#endif //__ND_EXTENTS_H__k7j1h5g9f3d7s1a5p9o3i7u1y5t9r3
@@ -0,0 +1,195 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_FAST_DIVISOR_H__m4n8b2v6c0x4z8l2k6j0h4g8f2d6s0
+#define __ND_FAST_DIVISOR_H__m4n8b2v6c0x4z8l2k6j0h4g8f2d6s0
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//====================================================================================================
+//===== class fast_divisor
+//====================================================================================================
+/*
+ * division of 32-bit unsigned values by a run-time constant via multiply and shift (Granlund / Montgomery),
+ * exact for all dividends:
+ *
+ *     const nd::fast_divisor d(640);
+ *     d.divide(lid); // == lid / 640, without a div instruction
+ *
+ * nd::grid and nd::vector keep one per stride, so list_to_grid_id() does not divide
+ */
+namespace nd
+{
+class fast_divisor
+{
+  private:
+    std::uint32_t _divisor    = 1;
+    std::uint32_t _multiplier = 1;
+    std::uint32_t _shift1     = 0;
+    std::uint32_t _shift2     = 0;
+
+  public:
+    constexpr fast_divisor() noexcept = default;
+
+    //! a divisor of 0 behaves like 1 (only used for empty containers)
+    constexpr explicit fast_divisor(std::uint32_t divisor) noexcept
+    {
+        if (divisor <= 1)
+        {
+            return;
+        }
+
+        // l = ceil(log2(divisor)), multiplier = floor(2^32 (2^l - divisor) / divisor) + 1
+        std::uint32_t l = 0;
+
+        while ((std::uint64_t(1) << l) < divisor)
+        {
+            ++l;
+        }
+
+        _divisor    = divisor;
+        _multiplier = static_cast<std::uint32_t>(((std::uint64_t(1) << 32) * ((std::uint64_t(1) << l) - divisor)) / divisor + 1);
+        _shift1     = 1;
+        _shift2     = l - 1;
+    }
+
+    [[nodiscard]] constexpr std::uint32_t
+    divisor() const noexcept
+    {
+        return _divisor;
+    }
+
+    [[nodiscard]] constexpr std::uint32_t
+    divide(std::uint32_t n) const noexcept
+    {
+        const auto t = static_cast<std::uint32_t>((static_cast<std::uint64_t>(_multiplier) * n) >> 32);
+        return (t + ((n - t) >> _shift1)) >> _shift2;
+    }
+};
+
+namespace detail
+{
+//! converts list ids blockwise, one dimension at a time over the block, so that the inner loops vectorize
+/*!
+ * - writes TDimensions grid coordinates per list id to out
+ * - dimensions are processed from largest to smallest stride
+ */
+template<std::size_t TDimensions, typename TSize, typename TInputIterator, typename TOutputIterator>
+TOutputIterator
+list_to_grid_ids(TInputIterator first, TInputIterator last, TOutputIterator out, const TSize* strides, const fast_divisor* divisors, bool lastAxisContiguous)
+{
+    constexpr std::size_t blockSize = 256;
+
+    std::array<TSize, blockSize>               rem{};
+    std::array<TSize, blockSize * TDimensions> coords{}; // dimension-major
+
+    while (first != last)
+    {
+        std::size_t n = 0;
+
+        for (; n < blockSize && first != last; ++n, ++first)
+        {
+            rem[n] = static_cast<TSize>(*first);
+        }
+
+        for (std::size_t k = 0; k + 1 < TDimensions; ++k)
+        {
+            const std::size_t  d      = lastAxisContiguous ? k : TDimensions - 1 - k;
+            const fast_divisor div    = divisors[d];
+            const TSize        stride = strides[d];
+            TSize*             c      = coords.data() + d * blockSize;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const TSize q = div.divide(rem[i]);
+
+                c[i] = q;
+                rem[i] -= q * stride;
+            }
+        }
+
+        std::copy(rem.begin(), rem.begin() + static_cast<std::ptrdiff_t>(n), coords.begin() + static_cast<std::ptrdiff_t>((lastAxisContiguous ? TDimensions - 1 : 0) * blockSize));
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            for (std::size_t d = 0; d < TDimensions; ++d)
+            {
+                *out++ = coords[d * blockSize + i];
+            }
+        }
+    }
+
+    return out;
+}
+
+//! run-time number of dimensions, e.g., nd::vector; dispatches to the fixed-rank version up to 8 dimensions
+template<typename TSize, typename TInputIterator, typename TOutputIterator, std::size_t N = 1>
+TOutputIterator
+list_to_grid_ids(TInputIterator first, TInputIterator last, TOutputIterator out, std::size_t numDimensions, const TSize* strides,
+                 const fast_divisor* divisors, bool lastAxisContiguous)
+{
+    if (numDimensions == N)
+    {
+        return list_to_grid_ids<N>(first, last, out, strides, divisors, lastAxisContiguous);
+    }
+
+    if constexpr (N < 8)
+    {
+        return list_to_grid_ids<TSize, TInputIterator, TOutputIterator, N + 1>(first, last, out, numDimensions, strides, divisors, lastAxisContiguous);
+    }
+    else
+    {
+        // rare: one id at a time
+        std::vector<TSize> gid(numDimensions);
+
+        for (; first != last; ++first)
+        {
+            auto lid = static_cast<TSize>(*first);
+
+            for (std::size_t k = 0; k + 1 < numDimensions; ++k)
+            {
+                const std::size_t d = lastAxisContiguous ? k : numDimensions - 1 - k;
+
+                gid[d] = divisors[d].divide(lid);
+                lid -= gid[d] * strides[d];
+            }
+
+            gid[lastAxisContiguous ? numDimensions - 1 : 0] = lid;
+            out = std::copy(gid.begin(), gid.end(), out);
+        }
+
+        return out;
+    }
+}
+} // namespace detail
+} // namespace nd
+
+#endif //__ND_FAST_DIVISOR_H__m4n8b2v6c0x4z8l2k6j0h4g8f2d6s0
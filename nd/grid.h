@@ -37,10 +37,18 @@
 #include <numeric>
 #include <ostream>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "charconv.h"
+#include "convert.h"
+#include "fast_divisor.h"
+#include "layout.h"
+#include "mdspan.h"
+
 #if !defined(__GNUC__) || defined(__MINGW32__)
   #define ND_FORCE_INLINE __forceinline
 #else // IF __GNUC__
@@ -49,7 +57,10 @@
 
 namespace nd
 {
-template<typename TValue, std::size_t TDimensions>
+template<typename TValue, layout TLayout>
+class vector;
+
+template<typename TValue, std::size_t TDimensions, layout TLayout = layout::last_axis_contiguous>
 class grid
 {
     //------------------------------------------------------------------------------------------------------
@@ -67,7 +78,13 @@ class grid
         return TDimensions;
     }
 
-    using self_type = grid<TValue, TDimensions>;
+    [[nodiscard]] ND_FORCE_INLINE static constexpr layout
+    memory_layout() noexcept
+    {
+        return TLayout;
+    }
+
+    using self_type = grid<TValue, TDimensions, TLayout>;
     using value_type = TValue;
     using data_container_type = std::vector<value_type>;
     using size_type = unsigned int;
@@ -87,7 +104,9 @@ class grid
   private:
     std::array<size_type, TDimensions> _sizes;
     std::array<size_type, TDimensions> _strides;
-    data_container_type                _values;
+    //! _strides as multiply / shift divisors for list_to_grid_id()
+    std::array<fast_divisor, TDimensions> _divisors;
+    data_container_type                   _values;
 
     //------------------------------------------------------------------------------------------------------
     // helpers
@@ -133,6 +152,7 @@ class grid
     grid(std::index_sequence<Is...>) :
         _sizes{Is...}
         , _strides{Is...}
+        , _divisors{}
         , _values()
     {
     }
@@ -149,12 +169,50 @@ class grid
 
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     ND_FORCE_INLINE
-    grid(const grid<K, TDimensions>& other) :
+    grid(const grid<K, TDimensions, TLayout>& other) :
         _sizes{other.size()}
         , _strides{other.strides()}
-        , _values(other.data().begin(), other.data().end())
+        , _divisors{}
+        , _values(other.num_values())
     {
         static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
+        _calc_divisors();
+        detail::convert_values(other.data(), _values);
+    }
+
+    //! copies a grid with the other memory layout; values are reordered so that (i, j, ...) stays the same element
+    template<typename K, layout TOtherLayout, std::enable_if_t<TOtherLayout != TLayout>* = nullptr>
+    explicit grid(const grid<K, TDimensions, TOtherLayout>& other) :
+        _sizes{other.size()}
+        , _strides{}
+        , _values(other.num_values())
+    {
+        static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
+
+        _calc_strides();
+
+        // walk this grid in list order and advance the list id of the other grid along with the grid id
+        std::array<size_type, TDimensions> gid{};
+        size_type                          otherLid = 0;
+
+        for (size_type i = 0; i < num_values(); ++i)
+        {
+            _values[i] = static_cast<value_type>(other[otherLid]);
+
+            for (size_type k = num_dimensions(); k-- > 0;)
+            {
+                const size_type d = _dim_by_stride(k);
+
+                if (++gid[d] < size(d))
+                {
+                    otherLid += other.stride(d);
+                    break;
+                }
+
+                otherLid -= (size(d) - 1) * other.stride(d);
+                gid[d] = 0;
+            }
+        }
     }
 
     template<typename... TSizes, std::enable_if_t<std::conjunction_v<std::is_arithmetic<std::decay_t<TSizes>>...>>* = nullptr>
@@ -181,6 +239,44 @@ class grid
         _calc_strides();
     }
 
+    //! takes over the values of an nd::vector< T > with the same layout without copying; other is left empty
+    /*!
+     * throws std::invalid_argument if other.num_dimensions() != N
+     */
+    explicit grid(vector<value_type, TLayout>&& other) :
+        grid()
+    {
+        if (other.num_dimensions() != TDimensions)
+        {
+            throw std::invalid_argument("grid: vector has " + std::to_string(other.num_dimensions()) + " dimensions, expected " + std::to_string(TDimensions));
+        }
+
+        std::copy(other.size().begin(), other.size().end(), _sizes.begin());
+        _values = other.release();
+        _calc_strides();
+    }
+
+    //! wraps existing values (in list order of TLayout) as a grid without copying
+    /*!
+     * throws std::invalid_argument if values.size() does not match the product of sizes
+     */
+    [[nodiscard]] static self_type
+    from_vector(data_container_type&& values, const std::array<size_type, TDimensions>& sizes)
+    {
+        self_type g;
+        g._sizes = sizes;
+
+        if (g.num_values_from_sizes() != values.size())
+        {
+            throw std::invalid_argument("from_vector: " + std::to_string(values.size()) + " values do not match sizes with " + std::to_string(g.num_values_from_sizes()) + " values");
+        }
+
+        g._values = std::move(values);
+        g._calc_strides();
+
+        return g;
+    }
+
     ND_FORCE_INLINE ~grid() = default;
 
     [[maybe_unused]] ND_FORCE_INLINE self_type&
@@ -191,15 +287,16 @@ class grid
 
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     [[maybe_unused]] ND_FORCE_INLINE self_type&
-    operator=(const grid<K, TDimensions>& other)
+    operator=(const grid<K, TDimensions, TLayout>& other)
     {
         static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
 
         _sizes   = other.size();
         _strides = other.strides();
+        _calc_divisors();
 
         _values.resize(other.num_values());
-        std::copy(other.data().begin(), other.data().end(), _values.begin());
+        detail::convert_values(other.data(), _values);
 
         return *this;
     }
@@ -208,28 +305,46 @@ class grid
     // cast
     //------------------------------------------------------------------------------------------------------
     template<typename T>
-    [[nodiscard]] ND_FORCE_INLINE grid<T, TDimensions>
+    [[nodiscard]] ND_FORCE_INLINE grid<T, TDimensions, TLayout>
     cast() const
     {
         static_assert(std::is_convertible_v<value_type, T>, "cannot cast types");
-        return grid<T, TDimensions>(*this);
+        return grid<T, TDimensions, TLayout>(*this);
     }
 
     //------------------------------------------------------------------------------------------------------
     // stride
     //------------------------------------------------------------------------------------------------------
   private:
+    //! dimension with the k-th largest stride
+    [[nodiscard]] ND_FORCE_INLINE static constexpr size_type
+    _dim_by_stride(size_type k) noexcept
+    {
+        return TLayout == layout::last_axis_contiguous ? k : static_cast<size_type>(TDimensions) - 1 - k;
+    }
+
     void
     _calc_strides()
     {
-        for (size_type i = 0; i < num_dimensions(); ++i)
+        size_type s = 1U;
+
+        for (size_type k = num_dimensions(); k-- > 0;)
         {
-            _strides[i] = 1U;
+            const size_type d = _dim_by_stride(k);
 
-            for (size_type k = i + 1; k < num_dimensions(); ++k)
-            {
-                _strides[i] *= _sizes[k];
-            }
+            _strides[d] = s;
+            s *= _sizes[d];
+        }
+
+        _calc_divisors();
+    }
+
+    void
+    _calc_divisors() noexcept
+    {
+        for (size_type d = 0; d < num_dimensions(); ++d)
+        {
+            _divisors[d] = fast_divisor(_strides[d]);
         }
     }
 
@@ -279,29 +394,31 @@ class grid
 
         std::array<size_type, TDimensions> gid{};
 
-        const auto str = strides();
-
-        for (size_type i = 0; i < num_dimensions() - 1; ++i)
+        // divide by the strides from largest to smallest; the contiguous dimension gets the remainder
+        for (size_type k = 0; k < num_dimensions() - 1; ++k)
         {
-            gid[i] = lid;
-
-            for (size_type k = 0; k < i; ++k)
-            {
-                gid[i] -= str[k] * gid[k];
-            }
+            const size_type d = _dim_by_stride(k);
 
-            gid[i] /= str[i];
+            gid[d] = _divisors[d].divide(lid);
+            lid -= gid[d] * _strides[d];
         }
 
-        gid[num_dimensions() - 1] = lid;
-        for (size_type i = 0; i < num_dimensions() - 1; ++i)
-        {
-            gid[num_dimensions() - 1] -= str[i] * gid[i];
-        }
+        gid[_dim_by_stride(num_dimensions() - 1)] = lid;
 
         return gid;
     }
 
+    //! list_to_grid_id() for each list id in [first, last); writes num_dimensions() coordinates per id to out
+    /*!
+     * converts blocks of ids one dimension at a time, which vectorizes better than single conversions
+     */
+    template<typename TInputIterator, typename TOutputIterator>
+    TOutputIterator
+    list_to_grid_ids(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+        return detail::list_to_grid_ids<TDimensions>(first, last, out, _strides.data(), _divisors.data(), TLayout == layout::last_axis_contiguous);
+    }
+
   private:
     template<typename TIndexAccessible>
     [[nodiscard]] ND_FORCE_INLINE size_type
@@ -382,6 +499,58 @@ class grid
         return std::move(_values);
     }
 
+    //! moves the values out without copying; the grid is left empty
+    [[nodiscard]] data_container_type
+    release() noexcept
+    {
+        data_container_type values = std::move(_values);
+        clear();
+
+        return values;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // span / mdspan
+    //------------------------------------------------------------------------------------------------------
+    using mdspan_type = mdspan<value_type, dextents<TDimensions>, detail::mdspan_layout_t<TLayout>>;
+    using const_mdspan_type = mdspan<const value_type, dextents<TDimensions>, detail::mdspan_layout_t<TLayout>>;
+
+    //! zero-copy view of all values in list order
+    [[nodiscard]] span<value_type>
+    as_span() noexcept
+    {
+        return span<value_type>(_values.data(), _values.size());
+    }
+
+    [[nodiscard]] span<const value_type>
+    as_span() const noexcept
+    {
+        return span<const value_type>(_values.data(), _values.size());
+    }
+
+    //! zero-copy multidimensional view; invalidated by resizing
+    [[nodiscard]] mdspan_type
+    as_mdspan() noexcept
+    {
+        return _as_mdspan<mdspan_type>(_values.data(), std::make_index_sequence<TDimensions>());
+    }
+
+    [[nodiscard]] const_mdspan_type
+    as_mdspan() const noexcept
+    {
+        return _as_mdspan<const_mdspan_type>(_values.data(), std::make_index_sequence<TDimensions>());
+    }
+
+  private:
+    template<typename TMdspan, typename TPointer, std::size_t... Is>
+    [[nodiscard]] TMdspan
+    _as_mdspan(TPointer data, std::index_sequence<Is...>) const noexcept
+    {
+        return TMdspan(data, _sizes[Is]...);
+    }
+
+  public:
+
     //------------------------------------------------------------------------------------------------------
     // num values
     //------------------------------------------------------------------------------------------------------
@@ -724,8 +893,9 @@ class grid
     {
         for (std::size_t i = 0; i < TDimensions; ++i)
         {
-            _sizes[i]   = 0;
-            _strides[i] = 0;
+            _sizes[i]    = 0;
+            _strides[i]  = 0;
+            _divisors[i] = fast_divisor();
         }
 
         _values.clear();
@@ -749,6 +919,72 @@ class grid
         _values.reserve(size0 * (sizes * ... * 1U));
     }
 
+    //------------------------------------------------------------------------------------------------------
+    // append slice
+    //------------------------------------------------------------------------------------------------------
+    //! appends a slice of size (size(1), ..., size(N-1)) at the end of dimension 0
+    /*!
+     * - with layout::first_axis_contiguous, the slice has size (size(0), ..., size(N-2)) and is appended at the end of dimension N-1
+     * - the slice is any container with size() and begin() / end() in list order, e.g., nd::grid< T, N-1 > with the same layout
+     * - if the grid is empty, the slice defines the sizes of the remaining dimensions
+     * - existing values are kept; the storage grows with amortized capacity.
+     *   Use reserve(expectedNumSlices, sizes of a slice...) to avoid reallocations entirely
+     * - throws std::invalid_argument if the slice sizes do not match
+     */
+    template<typename TSlice, std::enable_if_t<std::is_class_v<TSlice>>* = nullptr>
+    void
+    append_slice(const TSlice& slice)
+    {
+        static_assert(TDimensions > 1, "append_slice() requires at least 2 dimensions");
+
+        if constexpr (detail::layout_of<TSlice>::known && TDimensions > 2)
+        {
+            static_assert(detail::layout_of<TSlice>::value == TLayout, "append_slice: the slice must have the same memory layout");
+        }
+
+        constexpr size_type outerDim = _dim_by_stride(0);
+        constexpr size_type firstDim = outerDim == 0 ? 1 : 0;
+
+        const auto& sliceSizes = slice.size();
+
+        if (sliceSizes.size() != TDimensions - 1 || std::any_of(sliceSizes.begin(), sliceSizes.end(), [](auto x){return x == 0;}))
+        {
+            throw std::invalid_argument("append_slice: invalid slice sizes");
+        }
+
+        if (empty())
+        {
+            _sizes[outerDim] = 0;
+            std::copy(sliceSizes.begin(), sliceSizes.end(), _sizes.begin() + firstDim);
+            _calc_strides();
+        }
+        else if (!std::equal(sliceSizes.begin(), sliceSizes.end(), _sizes.begin() + firstDim))
+        {
+            throw std::invalid_argument("append_slice: slice sizes do not match");
+        }
+
+        _values.insert(_values.end(), slice.begin(), slice.end());
+        ++_sizes[outerDim];
+    }
+
+    //! appends the values [first, last) of a slice in list order; the grid must not be empty
+    template<typename TForwardIterator>
+    void
+    append_slice(TForwardIterator first, TForwardIterator last)
+    {
+        static_assert(TDimensions > 1, "append_slice() requires at least 2 dimensions");
+
+        constexpr size_type outerDim = _dim_by_stride(0);
+
+        if (empty() || static_cast<std::size_t>(std::distance(first, last)) != stride(outerDim))
+        {
+            throw std::invalid_argument("append_slice: number of values does not match the slice size");
+        }
+
+        _values.insert(_values.end(), first, last);
+        ++_sizes[outerDim];
+    }
+
     //------------------------------------------------------------------------------------------------------
     // set values
     //------------------------------------------------------------------------------------------------------
@@ -775,10 +1011,11 @@ class grid
     //------------------------------------------------------------------------------------------------------
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     void
-    swap(grid<K, TDimensions>& other) noexcept
+    swap(grid<K, TDimensions, TLayout>& other) noexcept
     {
         std::copy(other.size().begin(), other.size().end(), _sizes.begin());
         std::copy(other.strides().begin(), other.strides().end(), _strides.begin());
+        _calc_divisors();
 
         _values.resize(num_values());
         for (size_type i = 0; i < num_values(); ++i)
@@ -791,10 +1028,11 @@ class grid
 
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     void
-    swap(grid<K, TDimensions>&& other) noexcept
+    swap(grid<K, TDimensions, TLayout>&& other) noexcept
     {
         std::copy(other.size().begin(), other.size().end(), _sizes.begin());
         std::copy(other.strides().begin(), other.strides().end(), _strides.begin());
+        _calc_divisors();
 
         _values.resize(num_values());
         for (size_type i = 0; i < num_values(); ++i)
@@ -808,6 +1046,7 @@ class grid
     {
         std::swap(_sizes, other._sizes);
         std::swap(_strides, other._strides);
+        std::swap(_divisors, other._divisors);
         std::swap(_values, other._values);
     }
 
@@ -815,8 +1054,9 @@ class grid
     swap(self_type&& other)
     {
         _sizes   = std::move(other._sizes);
-        _strides = std::move(other._strides);
-        _values  = std::move(other._values);
+        _strides  = std::move(other._strides);
+        _divisors = std::move(other._divisors);
+        _values   = std::move(other._values);
     }
 
     //------------------------------------------------------------------------------------------------------
@@ -825,7 +1065,7 @@ class grid
   private:
     template<typename K>
     [[nodiscard]] bool
-    _sizes_match(const grid<K, TDimensions>& other) const
+    _sizes_match(const grid<K, TDimensions, TLayout>& other) const
     {
         if (num_dimensions() != other.num_dimensions())
         {
@@ -850,7 +1090,7 @@ class grid
     //------------------------------------------------------------------------------------------------------
     template<typename K>
     [[nodiscard]] bool
-    _compare_data_vectors(const grid<K, TDimensions>& other, std::function<bool(const_reference, typename grid<K, TDimensions>::const_reference)> comp) const
+    _compare_data_vectors(const grid<K, TDimensions, TLayout>& other, std::function<bool(const_reference, typename grid<K, TDimensions, TLayout>::const_reference)> comp) const
     {
         if (!_sizes_match(other))
         {
@@ -869,7 +1109,7 @@ class grid
 
     template<typename K>
     [[nodiscard]] bool
-    operator==(const grid<K, TDimensions>& other) const
+    operator==(const grid<K, TDimensions, TLayout>& other) const
     {
         if constexpr (!std::is_convertible_v<value_type, K> || !std::is_convertible_v<K, value_type>)
         {
@@ -877,7 +1117,7 @@ class grid
         }
         else
         {
-            constexpr auto comp = [](const_reference x, typename grid<K, TDimensions>::const_reference y) -> bool
+            constexpr auto comp = [](const_reference x, typename grid<K, TDimensions, TLayout>::const_reference y) -> bool
             {
                 return x == y;
             };
@@ -888,7 +1128,7 @@ class grid
 
     template<typename K>
     [[nodiscard]] bool
-    operator<(const grid<K, TDimensions>& other) const
+    operator<(const grid<K, TDimensions, TLayout>& other) const
     {
         static_assert(std::is_convertible_v<value_type, K> && std::is_convertible_v<K, value_type>);
 
@@ -897,7 +1137,7 @@ class grid
             return num_values() < other.num_values();
         }
 
-        constexpr auto comp = [](const_reference x, typename grid<K, TDimensions>::const_reference y) -> bool
+        constexpr auto comp = [](const_reference x, typename grid<K, TDimensions, TLayout>::const_reference y) -> bool
         {
             return x < y;
         };
@@ -907,28 +1147,28 @@ class grid
 
     template<typename K>
     [[nodiscard]] ND_FORCE_INLINE bool
-    operator!=(const grid<K, TDimensions>& other) const
+    operator!=(const grid<K, TDimensions, TLayout>& other) const
     {
         return !operator==(other);
     }
 
     template<typename K>
     [[nodiscard]] ND_FORCE_INLINE bool
-    operator<=(const grid<K, TDimensions>& other) const
+    operator<=(const grid<K, TDimensions, TLayout>& other) const
     {
         return operator<(other) || operator==(other);
     }
 
     template<typename K>
     [[nodiscard]] ND_FORCE_INLINE bool
-    operator>(const grid<K, TDimensions>& other) const
+    operator>(const grid<K, TDimensions, TLayout>& other) const
     {
         return !operator<=(other);
     }
 
     template<typename K>
     [[nodiscard]] ND_FORCE_INLINE bool
-    operator>=(const grid<K, TDimensions>& other) const
+    operator>=(const grid<K, TDimensions, TLayout>& other) const
     {
         return !operator<(other);
     }
@@ -936,90 +1176,194 @@ class grid
     //------------------------------------------------------------------------------------------------------
     // to string
     //------------------------------------------------------------------------------------------------------
-    [[nodiscard]] std::string
-    to_string() const
+  private:
+    [[nodiscard]] std::size_t
+    _estimated_string_length() const noexcept
+    {
+        // rough guess per value incl. separator; 3D+ additionally prints the grid id of each value
+        constexpr std::size_t charsPerValue = std::is_floating_point_v<value_type> ? 12U : 6U;
+        const std::size_t     charsPerId    = num_dimensions() > 2 ? 4U * num_dimensions() + 3U : 0U;
+
+        return 2U + num_values() * (charsPerValue + charsPerId);
+    }
+
+    void
+    _format(std::string& s) const
     {
-        std::stringstream s;
+        s += '[';
 
         if constexpr (num_dimensions() == 1)
         {
-            s << "[";
-
             for (size_type i = 0; i < num_values(); ++i)
             {
-                s << operator[](i);
-
-                if (i < num_values() - 1)
+                if (i != 0)
                 {
-                    s << ", ";
+                    s += ", ";
                 }
-            }
 
-            s << "]";
+                detail::append_value(s, _values[i]);
+            }
         }
         else if constexpr (num_dimensions() == 2)
         {
-            s << "[";
-
+            // each printed row contains the values along dimension 0
             for (size_type y = 0; y < size(1); ++y)
             {
                 if (y != 0)
                 {
-                    s << " ";
+                    s += "\n ";
                 }
 
-                s << "[";
+                s += '[';
 
-                for (size_type x = 0; x < size(0); ++x)
+                size_type lid = y * stride(1);
+                for (size_type x = 0; x < size(0); ++x, lid += stride(0))
                 {
-                    s << at_grid(x, y);
-
-                    if (x < size(0) - 1)
+                    if (x != 0)
                     {
-                        s << ", ";
+                        s += ", ";
                     }
-                }
-
-                s << "]";
 
-                if (y < size(1) - 1)
-                {
-                    s << "\n";
+                    detail::append_value(s, _values[lid]);
                 }
-            }
 
-            s << "]";
+                s += ']';
+            }
         }
         else
         {
-            s << "[";
+            // values are printed with the last dimension running fastest regardless of the memory layout;
+            // the list id is advanced along with the grid id instead of being recomputed via grid_to_list_id()
+            std::array<size_type, TDimensions> gid{};
+            size_type                          lid = 0;
 
             for (size_type i = 0; i < num_values(); ++i)
             {
-                const auto gid = list_to_grid_id(i);
-                s << "(";
-                for (size_type k = 0; k < gid.size(); ++k)
+                if (i != 0)
+                {
+                    s += ", ";
+                }
+
+                s += '(';
+                for (size_type k = 0; k < num_dimensions(); ++k)
                 {
-                    s << gid[k];
-                    if (k < gid.size() - 1)
+                    if (k != 0)
                     {
-                        s << ",";
+                        s += ',';
                     }
+
+                    detail::append_index(s, gid[k]);
                 }
-                s << ")=";
+                s += ")=";
 
-                s << operator[](i);
+                detail::append_value(s, _values[lid]);
 
-                if (i < num_values() - 1)
+                for (size_type k = num_dimensions(); k-- > 0;)
                 {
-                    s << ", ";
+                    if (++gid[k] < size(k))
+                    {
+                        lid += stride(k);
+                        break;
+                    }
+
+                    lid -= (size(k) - 1) * stride(k);
+                    gid[k] = 0;
                 }
             }
+        }
+
+        s += ']';
+    }
+
+  public:
+
+    [[nodiscard]] std::string
+    to_string() const
+    {
+        std::string s;
+        s.reserve(_estimated_string_length());
+        _format(s);
+        return s;
+    }
+
+    //! writes to_string() to an output iterator, e.g., std::ostreambuf_iterator<char> or std::back_inserter
+    template<typename TOutputIterator>
+    TOutputIterator
+    format_to(TOutputIterator out) const
+    {
+        const std::string s = to_string();
+        return std::copy(s.begin(), s.end(), out);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // from string
+    //------------------------------------------------------------------------------------------------------
+  public:
+    //! inverse of to_string()
+    [[nodiscard]] static self_type
+    from_string(std::string_view str)
+    {
+        std::vector<size_type>  sizes;
+        std::vector<value_type> values;
+        detail::parse_string(str, sizes, values);
+
+        self_type res;
+
+        if (values.empty())
+        {
+            return res;
+        }
+
+        if (sizes.size() != num_dimensions())
+        {
+            throw std::invalid_argument("from_string: number of dimensions does not match");
+        }
 
-            s << "]";
+        std::copy(sizes.begin(), sizes.end(), res._sizes.begin());
+        res._calc_strides();
+
+        if constexpr (num_dimensions() == 2)
+        {
+            res._values.resize(values.size());
+
+            for (size_type y = 0, t = 0; y < res.size(1); ++y)
+            {
+                for (size_type x = 0; x < res.size(0); ++x)
+                {
+                    res._values[x * res.stride(0) + y * res.stride(1)] = values[t++];
+                }
+            }
         }
+        else if constexpr (TLayout == layout::last_axis_contiguous)
+        {
+            res._values = std::move(values);
+        }
+        else
+        {
+            res._values.resize(values.size());
+
+            std::array<size_type, TDimensions> gid{};
+            size_type                          lid = 0;
 
-        return s.str();
+            for (size_type t = 0; t < values.size(); ++t)
+            {
+                res._values[lid] = values[t];
+
+                for (size_type k = num_dimensions(); k-- > 0;)
+                {
+                    if (++gid[k] < res.size(k))
+                    {
+                        lid += res.stride(k);
+                        break;
+                    }
+
+                    lid -= (res.size(k) - 1) * res.stride(k);
+                    gid[k] = 0;
+                }
+            }
+        }
+
+        return res;
     }
 }; // class grid
 } // namespace nd
@@ -1027,9 +1371,9 @@ class grid
 //------------------------------------------------------------------------------------------------------
 // external stream operator
 //------------------------------------------------------------------------------------------------------
-template<typename T, std::size_t Dims>
+template<typename T, std::size_t Dims, nd::layout L>
 [[maybe_unused]] std::ostream&
-operator<<(std::ostream& o, const nd::grid<T, Dims>& v)
+operator<<(std::ostream& o, const nd::grid<T, Dims, L>& v)
 {
     o << v.to_string();
     return o;
@@ -1038,25 +1382,33 @@ operator<<(std::ostream& o, const nd::grid<T, Dims>& v)
 //------------------------------------------------------------------------------------------------------
 // external swap
 //------------------------------------------------------------------------------------------------------
-template<typename T, typename K, std::size_t Dims>
+template<typename T, typename K, std::size_t Dims, nd::layout L>
 ND_FORCE_INLINE inline void
-swap(nd::grid<T, Dims>& a, nd::grid<K, Dims>& b) noexcept
+swap(nd::grid<T, Dims, L>& a, nd::grid<K, Dims, L>& b) noexcept
 {
     a.swap(b);
 }
 
-template<typename T, typename K, std::size_t Dims>
+template<typename T, typename K, std::size_t Dims, nd::layout L>
 ND_FORCE_INLINE inline void
-swap(nd::grid<T, Dims>&& a, nd::grid<K, Dims>& b) noexcept
+swap(nd::grid<T, Dims, L>&& a, nd::grid<K, Dims, L>& b) noexcept
 {
     b.swap(std::move(a));
 }
 
-template<typename T, typename K, std::size_t Dims>
+template<typename T, typename K, std::size_t Dims, nd::layout L>
 ND_FORCE_INLINE inline void
-swap(nd::grid<T, Dims>& a, nd::grid<K, Dims>&& b) noexcept
+swap(nd::grid<T, Dims, L>& a, nd::grid<K, Dims, L>&& b) noexcept
 {
     a.swap(std::move(b));
 }
 
+//------------------------------------------------------------------------------------------------------
+// precompiled instantiations (bk::ndcontainer_precompiled)
+//------------------------------------------------------------------------------------------------------
+#ifdef ND_PRECOMPILED
+  #include "precompiled.h"
+ND_PRECOMPILED_GRID_INSTANTIATIONS(extern)
+#endif
+
 #endif //__ND_GRID_H__8945u23895cuifnui34nf892348923m98r
\ No newline at end of file
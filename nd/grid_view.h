@@ -0,0 +1,298 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_GRID_VIEW_H__r7t1y5u9i3o7p1a5s9d3f7g1h5j9k3
+#define __ND_GRID_VIEW_H__r7t1y5u9i3o7p1a5s9d3f7g1h5j9k3
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "layout.h"
+
+//====================================================================================================
+//===== class grid_view
+//====================================================================================================
+/*
+ * non-owning view with a compile-time number of dimensions on contiguous values:
+ *
+ *     nd::grid_view<float, 3> v(g);   // from nd::grid< float, 3 >, any layout
+ *     v(x, y, z) = 1;                 // index math over N strides, unrolled
+ *
+ *     runtime_dims.visit([](auto v) { // nd::vector: v is a grid_view< T, N > with N = num_dimensions()
+ *         constexpr std::size_t N = decltype(v)::num_dimensions();
+ *         ...
+ *     });
+ *
+ * - the view does not own the values; resizing the viewed container invalidates it
+ */
+namespace nd
+{
+template<typename T, std::size_t TDimensions>
+class grid_view;
+
+namespace detail
+{
+template<typename T>
+struct is_grid_view : std::false_type
+{
+};
+
+template<typename T, std::size_t N>
+struct is_grid_view<grid_view<T, N>> : std::true_type
+{
+};
+} // namespace detail
+
+template<typename T, std::size_t TDimensions>
+class grid_view
+{
+    static_assert(TDimensions > 0, "template num dimension must be greater than 0");
+
+  public:
+    [[nodiscard]] static constexpr std::size_t
+    num_dimensions() noexcept
+    {
+        return TDimensions;
+    }
+
+    using self_type = grid_view<T, TDimensions>;
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = unsigned int;
+    using difference_type = int;
+    using reference = T&;
+    using pointer = T*;
+    using iterator = T*;
+    using grid_id_type = std::array<size_type, TDimensions>;
+
+  private:
+    T*           _data = nullptr;
+    grid_id_type _sizes{};
+    grid_id_type _strides{};
+    layout       _layout = layout::last_axis_contiguous;
+
+    template<typename TContainer>
+    [[nodiscard]] static constexpr layout
+    _layout_of() noexcept
+    {
+        if constexpr (detail::layout_of<TContainer>::known)
+        {
+            return detail::layout_of<TContainer>::value;
+        }
+        else
+        {
+            return layout::last_axis_contiguous;
+        }
+    }
+
+  public:
+    constexpr grid_view() noexcept = default;
+
+    //! the layout cannot be derived from the strides if sizes are 1, so it is passed along
+    constexpr grid_view(T* data, const grid_id_type& sizes, const grid_id_type& strides, layout memoryLayout = layout::last_axis_contiguous) noexcept :
+        _data(data)
+        , _sizes(sizes)
+        , _strides(strides)
+        , _layout(memoryLayout)
+    {
+    }
+
+    //! view of a container with the same number of dimensions, e.g., nd::grid< T, N > or nd::array< T, ... >
+    template<typename TContainer, std::enable_if_t<!detail::is_grid_view<std::decay_t<TContainer>>::value && std::decay_t<TContainer>::num_dimensions() == TDimensions>* = nullptr>
+    constexpr grid_view(TContainer& c) noexcept :
+        _data(c.data().data())
+        , _layout(_layout_of<std::decay_t<TContainer>>())
+    {
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            _sizes[k]   = static_cast<size_type>(c.size(k));
+            _strides[k] = static_cast<size_type>(c.stride(k));
+        }
+    }
+
+    //! e.g., grid_view< float, N > -> grid_view< const float, N >
+    template<typename U, std::enable_if_t<!std::is_same_v<U, T> && std::is_convertible_v<U (*)[], T (*)[]>>* = nullptr>
+    constexpr grid_view(const grid_view<U, TDimensions>& other) noexcept :
+        _data(other.data())
+        , _sizes(other.size())
+        , _strides(other.strides())
+        , _layout(other.memory_layout())
+    {
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // getter
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] constexpr T*
+    data() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] constexpr const grid_id_type&
+    size() const noexcept
+    {
+        return _sizes;
+    }
+
+    [[nodiscard]] constexpr size_type
+    size(size_type dimId) const noexcept
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _sizes[dimId];
+    }
+
+    [[nodiscard]] constexpr const grid_id_type&
+    strides() const noexcept
+    {
+        return _strides;
+    }
+
+    [[nodiscard]] constexpr size_type
+    stride(size_type dimId) const noexcept
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _strides[dimId];
+    }
+
+    [[nodiscard]] constexpr layout
+    memory_layout() const noexcept
+    {
+        return _layout;
+    }
+
+    [[nodiscard]] constexpr size_type
+    num_values() const noexcept
+    {
+        size_type n = 1;
+
+        for (const size_type s: _sizes)
+        {
+            n *= s;
+        }
+
+        return _data == nullptr ? 0 : n;
+    }
+
+    [[nodiscard]] constexpr bool
+    empty() const noexcept
+    {
+        return num_values() == 0;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // list id / grid id conversion
+    //------------------------------------------------------------------------------------------------------
+  private:
+    template<std::size_t... Is, typename... Ids>
+    [[nodiscard]] constexpr size_type
+    _grid_to_list_id_pack(std::index_sequence<Is...>, const Ids& ... ids) const noexcept
+    {
+        return (0U + ... + (static_cast<size_type>(ids) * _strides[Is]));
+    }
+
+    template<std::size_t... Is, typename TIndexAccessible>
+    [[nodiscard]] constexpr size_type
+    _grid_to_list_id_index(std::index_sequence<Is...>, const TIndexAccessible& gid) const noexcept
+    {
+        return (0U + ... + (static_cast<size_type>(gid[Is]) * _strides[Is]));
+    }
+
+  public:
+    template<typename... Ids>
+    [[nodiscard]] constexpr size_type
+    grid_to_list_id(const Ids& ... ids) const noexcept
+    {
+        constexpr bool isIndexPack = sizeof...(Ids) == TDimensions && std::conjunction_v<std::is_integral<Ids>...>;
+
+        static_assert(isIndexPack || sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+        if constexpr (isIndexPack)
+        {
+            return _grid_to_list_id_pack(std::make_index_sequence<TDimensions>(), ids...);
+        }
+        else
+        {
+            return _grid_to_list_id_index(std::make_index_sequence<TDimensions>(), std::get<0>(std::forward_as_tuple(ids...)));
+        }
+    }
+
+    [[nodiscard]] constexpr grid_id_type
+    list_to_grid_id(size_type lid) const noexcept
+    {
+        assert(lid < num_values());
+
+        grid_id_type gid{};
+        const bool   lastAxisContiguous = _layout == layout::last_axis_contiguous;
+
+        // dimensions from largest to smallest stride
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            const size_type d = lastAxisContiguous ? k : static_cast<size_type>(TDimensions) - 1 - k;
+
+            gid[d] = lid / _strides[d];
+            lid -= gid[d] * _strides[d];
+        }
+
+        return gid;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // access
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] constexpr T&
+    operator[](size_type lid) const noexcept
+    {
+        assert(lid < num_values() && "id out of bounds");
+        return _data[lid];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] constexpr T&
+    operator()(const Ids& ... ids) const noexcept
+    {
+        return _data[grid_to_list_id(ids...)];
+    }
+
+    [[nodiscard]] constexpr T*
+    begin() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] constexpr T*
+    end() const noexcept
+    {
+        return _data + num_values();
+    }
+}; // class grid_view
+} // namespace nd
+
+#endif //__ND_GRID_VIEW_H__r7t1y5u9i3o7p1a5s9d3f7g1h5j9k3
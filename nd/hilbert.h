@@ -0,0 +1,517 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_HILBERT_H__k2j6h0g4f8d2s6a0p4o8i2u6y0t4r8
+#define __ND_HILBERT_H__k2j6h0g4f8d2s6a0p4o8i2u6y0t4r8
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//====================================================================================================
+//===== Hilbert order traversal of 2D / 3D containers
+//====================================================================================================
+/*
+ * Visits the positions of a 2D or 3D container (nd::array, nd::grid, nd::vector) in Hilbert order
+ * without changing its storage:
+ *
+ *     for (const auto& [gid, lid] : nd::hilbert_range(g))
+ *     {
+ *         process(g[lid], gid);
+ *     }
+ *
+ * - arbitrary (non power-of-two) sizes are supported via the generalized Hilbert curve ("gilbert"):
+ *   the box is split recursively into sub-boxes whose curves are joined end to end.
+ *   Consecutive positions are neighbours except for rare diagonal steps if sizes are odd
+ * - the recursion runs on an explicit stack inside the iterator, so each step costs O(1) amortized
+ *   and the stack depth is O(log(size))
+ * - list ids are computed via the strides of the container, so any memory layout works
+ */
+namespace nd
+{
+template<std::size_t TDimensions>
+class hilbert_traversal
+{
+    static_assert(TDimensions == 2 || TDimensions == 3, "Hilbert traversal is available for 2D and 3D containers");
+
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    using size_type = unsigned int;
+    using grid_id_type = std::array<size_type, TDimensions>;
+    //! (grid id, list id)
+    using value_type = std::pair<grid_id_type, size_type>;
+
+  private:
+    //! axis-aligned 3D integer vector; z is 0 for 2D
+    struct vec
+    {
+        std::int64_t v[3];
+
+        [[nodiscard]] constexpr std::int64_t&
+        operator[](std::size_t i) noexcept
+        {
+            return v[i];
+        }
+
+        [[nodiscard]] constexpr const std::int64_t&
+        operator[](std::size_t i) const noexcept
+        {
+            return v[i];
+        }
+
+        [[nodiscard]] friend constexpr vec
+        operator+(const vec& l, const vec& r) noexcept
+        {
+            return {l[0] + r[0], l[1] + r[1], l[2] + r[2]};
+        }
+
+        [[nodiscard]] friend constexpr vec
+        operator-(const vec& l, const vec& r) noexcept
+        {
+            return {l[0] - r[0], l[1] - r[1], l[2] - r[2]};
+        }
+
+        [[nodiscard]] friend constexpr vec
+        operator-(const vec& x) noexcept
+        {
+            return {-x[0], -x[1], -x[2]};
+        }
+    };
+
+    //! box with origin p that is traversed along a ("width"), b ("height") and c ("depth", 3D only)
+    struct frame
+    {
+        vec p;
+        vec a;
+        vec b;
+        vec c;
+    };
+
+    [[nodiscard]] static constexpr std::int64_t
+    _sgn(std::int64_t x) noexcept
+    {
+        return (x > 0) - (x < 0);
+    }
+
+    [[nodiscard]] static constexpr std::int64_t
+    _abs(std::int64_t x) noexcept
+    {
+        return x < 0 ? -x : x;
+    }
+
+    //! floor(x / 2)
+    [[nodiscard]] static constexpr std::int64_t
+    _half(std::int64_t x) noexcept
+    {
+        return x >= 0 ? x / 2 : -((1 - x) / 2);
+    }
+
+    [[nodiscard]] static constexpr vec
+    _sgn(const vec& v) noexcept
+    {
+        return {_sgn(v[0]), _sgn(v[1]), _sgn(v[2])};
+    }
+
+    [[nodiscard]] static constexpr vec
+    _half(const vec& v) noexcept
+    {
+        return {_half(v[0]), _half(v[1]), _half(v[2])};
+    }
+
+    //! length of an axis-aligned vector
+    [[nodiscard]] static constexpr std::int64_t
+    _length(const vec& v) noexcept
+    {
+        return _abs(v[0] + v[1] + v[2]);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // iterator
+    //------------------------------------------------------------------------------------------------------
+  public:
+    class iterator
+    {
+        friend class hilbert_traversal;
+
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename hilbert_traversal::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+      private:
+        vec                _strides{};
+        std::vector<frame> _stack;
+        vec                _pos{};        // next position of the current line
+        vec                _dir{};        // step of the current line
+        std::int64_t       _remaining = 0; // positions left in the current line
+        std::size_t        _index     = 0; // number of positions visited before the current one
+        std::size_t        _count     = 0; // total number of positions
+        value_type         _current{};
+
+        iterator(const grid_id_type& sizes, const grid_id_type& strides, bool isEnd)
+        {
+            _count = 1;
+
+            for (std::size_t k = 0; k < TDimensions; ++k)
+            {
+                _strides[k] = strides[k];
+                _count *= sizes[k];
+            }
+
+            if (isEnd || _count == 0)
+            {
+                _index = _count;
+                return;
+            }
+
+            const auto s0 = static_cast<std::int64_t>(sizes[0]);
+            const auto s1 = static_cast<std::int64_t>(sizes[1]);
+
+            if constexpr (TDimensions == 2)
+            {
+                _stack.push_back(s0 >= s1 ? frame{{0, 0, 0}, {s0, 0, 0}, {0, s1, 0}, {0, 0, 0}}
+                                          : frame{{0, 0, 0}, {0, s1, 0}, {s0, 0, 0}, {0, 0, 0}});
+            }
+            else
+            {
+                const auto s2 = static_cast<std::int64_t>(sizes[2]);
+
+                if (s0 >= s1 && s0 >= s2)
+                {
+                    _stack.push_back(frame{{0, 0, 0}, {s0, 0, 0}, {0, s1, 0}, {0, 0, s2}});
+                }
+                else if (s1 >= s0 && s1 >= s2)
+                {
+                    _stack.push_back(frame{{0, 0, 0}, {0, s1, 0}, {s0, 0, 0}, {0, 0, s2}});
+                }
+                else
+                {
+                    _stack.push_back(frame{{0, 0, 0}, {0, 0, s2}, {s0, 0, 0}, {0, s1, 0}});
+                }
+            }
+
+            _next();
+        }
+
+        void
+        _line(const vec& p, const vec& dir, std::int64_t n)
+        {
+            _pos       = p;
+            _dir       = dir;
+            _remaining = n;
+        }
+
+        //! replaces the box on top of the stack by a line or by its sub-boxes (pushed in reverse order)
+        void
+        _expand()
+        {
+            const frame f = _stack.back();
+            _stack.pop_back();
+
+            const std::int64_t w  = _length(f.a);
+            const std::int64_t h  = _length(f.b);
+            const vec          da = _sgn(f.a);
+            const vec          db = _sgn(f.b);
+
+            vec a2 = _half(f.a);
+            vec b2 = _half(f.b);
+
+            if constexpr (TDimensions == 2)
+            {
+                if (h == 1)
+                {
+                    _line(f.p, da, w);
+                    return;
+                }
+
+                if (w == 1)
+                {
+                    _line(f.p, db, h);
+                    return;
+                }
+
+                if (2 * w > 3 * h)
+                {
+                    if (_length(a2) % 2 != 0 && w > 2)
+                    {
+                        a2 = a2 + da;
+                    }
+
+                    _stack.push_back({f.p + a2, f.a - a2, f.b, f.c});
+                    _stack.push_back({f.p, a2, f.b, f.c});
+                }
+                else
+                {
+                    if (_length(b2) % 2 != 0 && h > 2)
+                    {
+                        b2 = b2 + db;
+                    }
+
+                    _stack.push_back({f.p + (f.a - da) + (b2 - db), -b2, -(f.a - a2), f.c});
+                    _stack.push_back({f.p + b2, f.a, f.b - b2, f.c});
+                    _stack.push_back({f.p, b2, a2, f.c});
+                }
+            }
+            else
+            {
+                const std::int64_t d  = _length(f.c);
+                const vec          dc = _sgn(f.c);
+
+                if (h == 1 && d == 1)
+                {
+                    _line(f.p, da, w);
+                    return;
+                }
+
+                if (w == 1 && d == 1)
+                {
+                    _line(f.p, db, h);
+                    return;
+                }
+
+                if (w == 1 && h == 1)
+                {
+                    _line(f.p, dc, d);
+                    return;
+                }
+
+                vec c2 = _half(f.c);
+
+                // prefer even steps
+                if (_length(a2) % 2 != 0 && w > 2)
+                {
+                    a2 = a2 + da;
+                }
+
+                if (_length(b2) % 2 != 0 && h > 2)
+                {
+                    b2 = b2 + db;
+                }
+
+                if (_length(c2) % 2 != 0 && d > 2)
+                {
+                    c2 = c2 + dc;
+                }
+
+                if (2 * w > 3 * h && 2 * w > 3 * d)
+                {
+                    // wide case: split in w only
+                    _stack.push_back({f.p + a2, f.a - a2, f.b, f.c});
+                    _stack.push_back({f.p, a2, f.b, f.c});
+                }
+                else if (3 * h > 4 * d)
+                {
+                    // do not split in d
+                    _stack.push_back({f.p + (f.a - da) + (b2 - db), -b2, f.c, -(f.a - a2)});
+                    _stack.push_back({f.p + b2, f.a, f.b - b2, f.c});
+                    _stack.push_back({f.p, b2, f.c, a2});
+                }
+                else if (3 * d > 4 * h)
+                {
+                    // do not split in h
+                    _stack.push_back({f.p + (f.a - da) + (c2 - dc), -c2, -(f.a - a2), f.b});
+                    _stack.push_back({f.p + c2, f.a, f.b, f.c - c2});
+                    _stack.push_back({f.p, c2, a2, f.b});
+                }
+                else
+                {
+                    // regular case: split in w, h and d
+                    _stack.push_back({f.p + (f.a - da) + (b2 - db), -b2, c2, -(f.a - a2)});
+                    _stack.push_back({f.p + (f.a - da) + b2 + (f.c - dc), -f.c, -(f.a - a2), f.b - b2});
+                    _stack.push_back({f.p + (b2 - db) + (f.c - dc), f.a, -b2, -(f.c - c2)});
+                    _stack.push_back({f.p + b2, f.c, a2, f.b - b2});
+                    _stack.push_back({f.p, b2, c2, a2});
+                }
+            }
+        }
+
+        void
+        _next()
+        {
+            while (_remaining == 0)
+            {
+                _expand();
+            }
+
+            std::int64_t lid = 0;
+
+            for (std::size_t k = 0; k < TDimensions; ++k)
+            {
+                _current.first[k] = static_cast<size_type>(_pos[k]);
+                lid += _pos[k] * _strides[k];
+            }
+
+            _current.second = static_cast<size_type>(lid);
+
+            _pos = _pos + _dir;
+            --_remaining;
+        }
+
+      public:
+        iterator() = default;
+
+        [[nodiscard]] reference
+        operator*() const noexcept
+        {
+            return _current;
+        }
+
+        [[nodiscard]] pointer
+        operator->() const noexcept
+        {
+            return &_current;
+        }
+
+        iterator&
+        operator++()
+        {
+            if (++_index < _count)
+            {
+                _next();
+            }
+
+            return *this;
+        }
+
+        //! number of positions visited before the current one
+        [[nodiscard]] std::size_t
+        index() const noexcept
+        {
+            return _index;
+        }
+
+        [[nodiscard]] bool
+        operator==(const iterator& other) const noexcept
+        {
+            return _index == other._index;
+        }
+
+        [[nodiscard]] bool
+        operator!=(const iterator& other) const noexcept
+        {
+            return _index != other._index;
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    grid_id_type _sizes{};
+    grid_id_type _strides{};
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    hilbert_traversal(const grid_id_type& sizes, const grid_id_type& strides) :
+        _sizes(sizes)
+        , _strides(strides)
+    {
+    }
+
+    [[nodiscard]] iterator
+    begin() const
+    {
+        return iterator(_sizes, _strides, false);
+    }
+
+    [[nodiscard]] iterator
+    end() const
+    {
+        return iterator(_sizes, _strides, true);
+    }
+
+    //! number of positions
+    [[nodiscard]] std::size_t
+    size() const noexcept
+    {
+        std::size_t n = 1;
+
+        for (size_type s: _sizes)
+        {
+            n *= s;
+        }
+
+        return n;
+    }
+};
+
+//! Hilbert order traversal of a 2D / 3D nd::array or nd::grid, yielding (grid id, list id) pairs
+/*!
+ * for nd::vector, the number of dimensions has to be given explicitly, e.g., hilbert_range<3>(v);
+ * throws std::invalid_argument if it does not match
+ */
+template<std::size_t TDimensions = 0, typename TContainer>
+[[nodiscard]] auto
+hilbert_range(const TContainer& c)
+{
+    constexpr std::size_t N = [&]()
+    {
+        if constexpr (TDimensions != 0)
+        {
+            return TDimensions;
+        }
+        else
+        {
+            return std::tuple_size_v<std::decay_t<decltype(c.size())>>;
+        }
+    }();
+
+    using traversal = hilbert_traversal<N>;
+
+    if (c.size().size() != N)
+    {
+        throw std::invalid_argument("hilbert_range: number of dimensions does not match");
+    }
+
+    typename traversal::grid_id_type sizes{};
+    typename traversal::grid_id_type strides{};
+
+    if (!c.empty())
+    {
+        for (std::size_t k = 0; k < N; ++k)
+        {
+            sizes[k]   = static_cast<typename traversal::size_type>(c.size()[k]);
+            strides[k] = static_cast<typename traversal::size_type>(c.strides()[k]);
+        }
+    }
+
+    return traversal(sizes, strides);
+}
+} // namespace nd
+
+#endif //__ND_HILBERT_H__k2j6h0g4f8d2s6a0p4o8i2u6y0t4r8
@@ -0,0 +1,451 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_KERNELS_H__q8w2e6r0t4y8u2i6o0p4a8s2d6f0g4
+#define __ND_KERNELS_H__q8w2e6r0t4y8u2i6o0p4a8s2d6f0g4
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "array.h"
+
+//====================================================================================================
+//===== kernels
+//====================================================================================================
+/*
+ * constexpr factories for convolution kernels of any rank and size as nd::array:
+ *
+ *     constexpr auto smooth = nd::normalize(nd::binomial_kernel<float, 5, 5>()); // 1 4 6 4 1 outer product / 256
+ *     constexpr std::size_t n = nd::gaussian_kernel_size(1.5);                   // 2 * ceil(3 * 1.5) + 1 = 11
+ *     constexpr auto g = nd::gaussian_kernel<float, n, n, n>(1.5);               // truncated at the borders, sum 1
+ *     constexpr auto dx = nd::sobel_kernel<float, 1, 3, 3>();                    // derivative along dimension 1
+ *
+ * - weights are correlation weights centered at size / 2 in each dimension: sum_k w(k) * f(x + k - size / 2).
+ *   derivative kernels thus respond positively to values increasing along the axis
+ * - binomial, sobel, scharr and 3-point laplacian kernels have integer weights (exact for integral T);
+ *   box and gaussian kernels are normalized to sum 1
+ * - everything is constexpr, so kernels bound to constexpr variables live in read-only data
+ */
+namespace nd
+{
+namespace detail
+{
+//! exp(x) usable in constant expressions: x = k ln(2) + r with |r| <= ln(2) / 2, Taylor series for exp(r)
+[[nodiscard]] constexpr double
+kernel_exp(double x) noexcept
+{
+    constexpr double ln2 = 0.693147180559945309417232121458;
+
+    const double kf = x / ln2;
+    const long   k  = static_cast<long>(kf < 0 ? kf - 0.5 : kf + 0.5);
+    const double r  = x - static_cast<double>(k) * ln2;
+
+    double term = 1;
+    double res  = 1;
+
+    for (int i = 1; i < 24; ++i)
+    {
+        term *= r / i;
+        res += term;
+    }
+
+    for (long i = 0; i < k; ++i)
+    {
+        res *= 2;
+    }
+
+    for (long i = 0; i > k; --i)
+    {
+        res *= 0.5;
+    }
+
+    return res;
+}
+
+[[nodiscard]] constexpr double
+kernel_binomial(std::size_t n, std::size_t k) noexcept
+{
+    unsigned long long c = 1;
+
+    for (std::size_t i = 1; i <= k; ++i)
+    {
+        c = c * (n - k + i) / i;
+    }
+
+    return static_cast<double>(c);
+}
+
+//! Fornberg's weights for the TOrder-th derivative at 0 from the points -(size / 2), ..., size / 2
+template<std::size_t TMaxSize, std::size_t TOrder>
+[[nodiscard]] constexpr std::array<double, TMaxSize>
+kernel_finite_difference(std::size_t size) noexcept
+{
+    assert(size <= TMaxSize && size % 2 == 1 && size > TOrder && "finite differences require an odd size greater than the order");
+
+    std::array<std::array<double, TOrder + 1>, TMaxSize> c{};
+
+    const auto x = [size](std::size_t i)
+    {
+        return static_cast<double>(i) - static_cast<double>(size / 2);
+    };
+
+    double c1 = 1;
+    double c4 = x(0);
+    c[0][0] = 1;
+
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        const std::size_t mn = i < TOrder ? i : TOrder;
+        double            c2 = 1;
+        const double      c5 = c4;
+        c4 = x(i);
+
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            const double c3 = x(i) - x(j);
+            c2 *= c3;
+
+            if (j == i - 1)
+            {
+                for (std::size_t k = mn; k >= 1; --k)
+                {
+                    c[i][k] = c1 * (static_cast<double>(k) * c[i - 1][k - 1] - c5 * c[i - 1][k]) / c2;
+                }
+
+                c[i][0] = -c1 * c5 * c[i - 1][0] / c2;
+            }
+
+            for (std::size_t k = mn; k >= 1; --k)
+            {
+                c[j][k] = (c4 * c[j][k] - static_cast<double>(k) * c[j][k - 1]) / c3;
+            }
+
+            c[j][0] = c4 * c[j][0] / c3;
+        }
+
+        c1 = c2;
+    }
+
+    std::array<double, TMaxSize> w{};
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        w[i] = c[i][TOrder];
+    }
+
+    return w;
+}
+
+//! w(gid) = prod_k f(k, gid[k])
+template<typename T, std::size_t... TSizes, typename TFunction>
+[[nodiscard]] constexpr array<T, TSizes...>
+separable_kernel(TFunction f) noexcept
+{
+    using array_type = array<T, TSizes...>;
+
+    array_type res{};
+
+    for (std::size_t lid = 0; lid < array_type::num_values(); ++lid)
+    {
+        const auto gid = array_type::list_to_grid_id(lid);
+        double     w   = 1;
+
+        for (std::size_t k = 0; k < array_type::num_dimensions(); ++k)
+        {
+            w *= f(k, gid[k]);
+        }
+
+        res[lid] = static_cast<T>(w);
+    }
+
+    return res;
+}
+
+//! w(gid) = f(k, gid[k]) if gid is at the center in all dimensions but k (summed for gid at the center)
+template<typename T, std::size_t... TSizes, typename TFunction>
+[[nodiscard]] constexpr array<T, TSizes...>
+axes_kernel(TFunction f) noexcept
+{
+    using array_type = array<T, TSizes...>;
+
+    constexpr std::array<std::size_t, sizeof...(TSizes)> sizes{TSizes...};
+
+    array_type res{};
+
+    for (std::size_t lid = 0; lid < array_type::num_values(); ++lid)
+    {
+        const auto gid = array_type::list_to_grid_id(lid);
+        double     w   = 0;
+
+        for (std::size_t k = 0; k < array_type::num_dimensions(); ++k)
+        {
+            bool centered = true;
+
+            for (std::size_t d = 0; d < array_type::num_dimensions(); ++d)
+            {
+                centered = centered && (d == k || gid[d] == sizes[d] / 2);
+            }
+
+            if (centered)
+            {
+                w += f(k, gid[k]);
+            }
+        }
+
+        res[lid] = static_cast<T>(w);
+    }
+
+    return res;
+}
+
+template<typename T, std::size_t TSize, typename TSequence>
+struct cube_array;
+
+template<typename T, std::size_t TSize, std::size_t... Is>
+struct cube_array<T, TSize, std::index_sequence<Is...>>
+{
+    using type = array<T, (static_cast<void>(Is), TSize)...>;
+};
+
+//! nd::array< T, TSize, ..., TSize > with TRank dimensions
+template<typename T, std::size_t TSize, std::size_t TRank>
+using cube_array_t = typename cube_array<T, TSize, std::make_index_sequence<TRank>>::type;
+
+template<typename T, std::size_t TRank, std::size_t... Is>
+[[nodiscard]] constexpr cube_array_t<T, 3, TRank>
+scharr_kernel(std::size_t axis, std::index_sequence<Is...>) noexcept
+{
+    return separable_kernel<T, (static_cast<void>(Is), std::size_t(3))...>([axis](std::size_t k, std::size_t i)
+    {
+        constexpr double derivative[3] = {-1, 0, 1};
+        constexpr double smooth[3]     = {3, 10, 3};
+
+        return k == axis ? derivative[i] : smooth[i];
+    });
+}
+} // namespace detail
+
+//------------------------------------------------------------------------------------------------------
+// smoothing
+//------------------------------------------------------------------------------------------------------
+//! all weights 1 / num_values()
+template<typename T, std::size_t... TSizes>
+[[nodiscard]] constexpr array<T, TSizes...>
+box_kernel() noexcept
+{
+    return array<T, TSizes...>::Constant(static_cast<T>(1.0 / static_cast<double>(array<T, TSizes...>::num_values())));
+}
+
+//! outer product of binomial coefficients, e.g., 1 2 1 for size 3; sum 2^(sum_k (size_k - 1))
+template<typename T, std::size_t... TSizes>
+[[nodiscard]] constexpr array<T, TSizes...>
+binomial_kernel() noexcept
+{
+    constexpr std::array<std::size_t, sizeof...(TSizes)> sizes{TSizes...};
+
+    return detail::separable_kernel<T, TSizes...>([&sizes](std::size_t k, std::size_t i)
+    {
+        return detail::kernel_binomial(sizes[k] - 1, i);
+    });
+}
+
+//! odd size covering +-truncate * sigma around the center
+[[nodiscard]] constexpr std::size_t
+gaussian_kernel_size(double sigma, double truncate = 3) noexcept
+{
+    const double r = truncate * sigma;
+    auto         n = static_cast<std::size_t>(r);
+
+    return 2 * (static_cast<double>(n) < r ? n + 1 : n) + 1;
+}
+
+//! isotropic gaussian sampled at the integer offsets, truncated at the kernel borders and normalized to sum 1
+template<typename T, std::size_t... TSizes>
+[[nodiscard]] constexpr array<T, TSizes...>
+gaussian_kernel(double sigma) noexcept
+{
+    assert(sigma > 0 && "sigma must be greater than 0");
+
+    constexpr std::array<std::size_t, sizeof...(TSizes)> sizes{TSizes...};
+
+    const auto g = detail::separable_kernel<double, TSizes...>([&sizes, sigma](std::size_t k, std::size_t i)
+    {
+        const double x = static_cast<double>(i) - static_cast<double>(sizes[k] - 1) / 2;
+        return detail::kernel_exp(-x * x / (2 * sigma * sigma));
+    });
+
+    double sum = 0;
+
+    for (std::size_t i = 0; i < g.num_values(); ++i)
+    {
+        sum += g[i];
+    }
+
+    array<T, TSizes...> res{};
+
+    for (std::size_t i = 0; i < res.num_values(); ++i)
+    {
+        res[i] = static_cast<T>(g[i] / sum);
+    }
+
+    return res;
+}
+
+//------------------------------------------------------------------------------------------------------
+// derivatives
+//------------------------------------------------------------------------------------------------------
+//! first derivative along TAxis, binomial smoothing along the other dimensions; e.g., -1 0 1 / 1 2 1 for size 3
+template<typename T, std::size_t TAxis, std::size_t... TSizes>
+[[nodiscard]] constexpr array<T, TSizes...>
+sobel_kernel() noexcept
+{
+    static_assert(TAxis < sizeof...(TSizes), "axis exceeds the number of dimensions");
+
+    constexpr std::array<std::size_t, sizeof...(TSizes)> sizes{TSizes...};
+    static_assert(sizes[TAxis] >= 3 && sizes[TAxis] % 2 == 1, "derivative axis requires an odd size >= 3");
+
+    return detail::separable_kernel<T, TSizes...>([&sizes](std::size_t k, std::size_t i)
+    {
+        if (k != TAxis)
+        {
+            return detail::kernel_binomial(sizes[k] - 1, i);
+        }
+
+        // binomial smoothing of size - 2 convolved with -1 0 1
+        const std::size_t n     = sizes[k] - 3;
+        const double      left  = i >= 2 && i - 2 <= n ? detail::kernel_binomial(n, i - 2) : 0.0;
+        const double      right = i <= n ? detail::kernel_binomial(n, i) : 0.0;
+
+        return left - right;
+    });
+}
+
+//! first derivative along TAxis with the rotation-optimized 3-point Scharr weights -1 0 1 / 3 10 3 (separable)
+template<typename T, std::size_t TAxis, std::size_t TRank = 2>
+[[nodiscard]] constexpr detail::cube_array_t<T, 3, TRank>
+scharr_kernel() noexcept
+{
+    static_assert(TAxis < TRank, "axis exceeds the number of dimensions");
+    return detail::scharr_kernel<T, TRank>(TAxis, std::make_index_sequence<TRank>());
+}
+
+//! TOrder-th derivative along TAxis with central finite differences of accuracy order size - 1 - (TOrder + 1) % 2
+/*!
+ * - non-zero only on the line through the center along TAxis, e.g., 1 -8 0 8 -1 / 12 for <T, 0, 1, 5>
+ * - all sizes must be odd
+ */
+template<typename T, std::size_t TAxis, std::size_t TOrder, std::size_t... TSizes>
+[[nodiscard]] constexpr array<T, TSizes...>
+finite_difference_kernel() noexcept
+{
+    static_assert(TAxis < sizeof...(TSizes), "axis exceeds the number of dimensions");
+    static_assert(((TSizes % 2 == 1) && ...), "all sizes must be odd");
+
+    constexpr std::array<std::size_t, sizeof...(TSizes)> sizes{TSizes...};
+    static_assert(sizes[TAxis] > TOrder, "size along the axis must be greater than the order");
+
+    constexpr auto w = detail::kernel_finite_difference<sizes[TAxis], TOrder>(sizes[TAxis]);
+
+    return detail::axes_kernel<T, TSizes...>([&w](std::size_t k, std::size_t i)
+    {
+        return k == TAxis ? w[i] : 0.0;
+    });
+}
+
+//! sum of the central second derivatives along all dimensions; for size 3: -2N at the center, 1 at the 2N face neighbours
+template<typename T, std::size_t... TSizes>
+[[nodiscard]] constexpr array<T, TSizes...>
+laplacian_kernel() noexcept
+{
+    static_assert(((TSizes >= 3 && TSizes % 2 == 1) && ...), "all sizes must be odd and >= 3");
+
+    constexpr std::size_t maxSize = std::max({TSizes...});
+
+    constexpr std::array<std::array<double, maxSize>, sizeof...(TSizes)> w{detail::kernel_finite_difference<maxSize, 2>(TSizes)...};
+
+    return detail::axes_kernel<T, TSizes...>([&w](std::size_t k, std::size_t i)
+    {
+        return w[k][i];
+    });
+}
+
+//------------------------------------------------------------------------------------------------------
+// normalization
+//------------------------------------------------------------------------------------------------------
+//! weights divided by their sum, e.g., for smoothing kernels
+template<typename T, layout TLayout, std::size_t... TSizes>
+[[nodiscard]] constexpr basic_array<T, TLayout, TSizes...>
+normalize(const basic_array<T, TLayout, TSizes...>& a) noexcept
+{
+    T sum = 0;
+
+    for (std::size_t i = 0; i < a.num_values(); ++i)
+    {
+        sum += a[i];
+    }
+
+    assert(sum != 0 && "weights sum up to 0, use normalize_abs()");
+
+    basic_array<T, TLayout, TSizes...> res = a;
+
+    for (std::size_t i = 0; i < res.num_values(); ++i)
+    {
+        res[i] /= sum;
+    }
+
+    return res;
+}
+
+//! weights divided by the sum of their absolute values, e.g., for derivative kernels
+template<typename T, layout TLayout, std::size_t... TSizes>
+[[nodiscard]] constexpr basic_array<T, TLayout, TSizes...>
+normalize_abs(const basic_array<T, TLayout, TSizes...>& a) noexcept
+{
+    T sum = 0;
+
+    for (std::size_t i = 0; i < a.num_values(); ++i)
+    {
+        sum += a[i] < 0 ? -a[i] : a[i];
+    }
+
+    assert(sum != 0 && "all weights are 0");
+
+    basic_array<T, TLayout, TSizes...> res = a;
+
+    for (std::size_t i = 0; i < res.num_values(); ++i)
+    {
+        res[i] /= sum;
+    }
+
+    return res;
+}
+} // namespace nd
+
+#endif //__ND_KERNELS_H__q8w2e6r0t4y8u2i6o0p4a8s2d6f0g4
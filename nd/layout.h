@@ -0,0 +1,65 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_LAYOUT_H__c3v8b1n6m4x9z2a7s5d0f3g8h1j6
+#define __ND_LAYOUT_H__c3v8b1n6m4x9z2a7s5d0f3g8h1j6
+
+#include <type_traits>
+
+namespace nd
+{
+//! memory layout of the n-dimensional containers
+/*!
+ * - last_axis_contiguous (default, "row major" / C order):
+ *   stride n-1 = 1, stride n-2 = size n-1, ..., stride 0 = size 1 * ... * size n-1
+ * - first_axis_contiguous ("column major" / Fortran order), e.g., for (x, y, z) indexing with x fastest:
+ *   stride 0 = 1, stride 1 = size 0, ..., stride n-1 = size 0 * ... * size n-2
+ */
+enum class layout
+{
+    last_axis_contiguous,
+    first_axis_contiguous
+};
+
+namespace detail
+{
+//! layout of containers that provide a static memory_layout()
+template<typename T, typename = void>
+struct layout_of
+{
+    static constexpr bool known = false;
+};
+
+template<typename T>
+struct layout_of<T, std::void_t<decltype(T::memory_layout())>>
+{
+    static constexpr bool   known = true;
+    static constexpr layout value = T::memory_layout();
+};
+} // namespace detail
+} // namespace nd
+
+#endif //__ND_LAYOUT_H__c3v8b1n6m4x9z2a7s5d0f3g8h1j6
@@ -0,0 +1,610 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_LINALG_H__z5x9c3v7b1n5m9q3w7e1r5t9y3u7i1
+#define __ND_LINALG_H__z5x9c3v7b1n5m9q3w7e1r5t9y3u7i1
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "array.h"
+
+//====================================================================================================
+//===== small fixed-size linear algebra
+//====================================================================================================
+/*
+ * constexpr matrix operations on nd::basic_array< T, L, M, N > (matrices) and nd::basic_array< T, L, N > (vectors):
+ *
+ *     constexpr nd::array<float, 3, 3> a(2, 0, 0, 0, 3, 0, 0, 0, 4);
+ *     constexpr auto b = nd::matmul(a, nd::transpose(a));
+ *     constexpr auto y = nd::matvec(a, nd::array<float, 3>(1, 1, 1));
+ *     constexpr float d = nd::det(a);                       // 24
+ *     const auto [values, vectors] = nd::symmetric_eigen(b); // ascending eigenvalues, eigenvectors as columns
+ *
+ * - matmul, matvec, transpose, det (N <= 4) and inverse (N <= 4) are expanded at compile time into straight-line
+ *   code over compile-time list ids (no loops, no index arithmetic), which the compiler can vectorize
+ * - det / inverse of larger matrices and symmetric_eigen (cyclic Jacobi) use loops over the fixed sizes
+ * - inverse() of a singular matrix yields inf / nan; check det() first if needed
+ */
+namespace nd
+{
+namespace detail
+{
+template<typename T>
+[[nodiscard]] constexpr T
+linalg_sqrt(T x) noexcept
+{
+#if defined(__has_builtin)
+  #if __has_builtin(__builtin_is_constant_evaluated)
+    if (!__builtin_is_constant_evaluated())
+    {
+        return std::sqrt(x);
+    }
+  #endif
+#endif
+
+    if (!(x > 0))
+    {
+        return 0;
+    }
+
+    // Newton iteration; converges monotonically from above
+    T r = x > 1 ? x : T(1);
+
+    for (int i = 0; i < 128; ++i)
+    {
+        const T next = (r + x / r) / 2;
+
+        if (!(next < r))
+        {
+            break;
+        }
+
+        r = next;
+    }
+
+    return r;
+}
+
+template<typename T>
+[[nodiscard]] constexpr T
+linalg_abs(T x) noexcept
+{
+    return x < 0 ? -x : x;
+}
+
+//! element (I, J) via its compile-time list id
+template<std::size_t I, std::size_t J, typename TMatrix>
+[[nodiscard]] constexpr decltype(auto)
+at(TMatrix& m) noexcept
+{
+    return m.template at_grid<I, J>();
+}
+
+template<std::size_t I, std::size_t J, typename TA, typename TB, std::size_t... Ks>
+[[nodiscard]] constexpr auto
+matmul_entry(const TA& a, const TB& b, std::index_sequence<Ks...>) noexcept
+{
+    return ((a.template at_grid<I, Ks>() * b.template at_grid<Ks, J>()) + ...);
+}
+
+template<typename TResult, typename TA, typename TB, std::size_t K, std::size_t... Ls>
+[[nodiscard]] constexpr TResult
+matmul(const TA& a, const TB& b, std::index_sequence<Ls...>) noexcept
+{
+    constexpr std::array<std::array<std::size_t, 2>, sizeof...(Ls)> gids{TResult::list_to_grid_id(Ls)...};
+    return TResult(matmul_entry<gids[Ls][0], gids[Ls][1]>(a, b, std::make_index_sequence<K>())...);
+}
+
+template<std::size_t I, typename TA, typename TX, std::size_t... Ks>
+[[nodiscard]] constexpr auto
+matvec_entry(const TA& a, const TX& x, std::index_sequence<Ks...>) noexcept
+{
+    return ((a.template at_grid<I, Ks>() * x.template at_list<Ks>()) + ...);
+}
+
+template<typename TResult, typename TA, typename TX, std::size_t N, std::size_t... Is>
+[[nodiscard]] constexpr TResult
+matvec(const TA& a, const TX& x, std::index_sequence<Is...>) noexcept
+{
+    return TResult(matvec_entry<Is>(a, x, std::make_index_sequence<N>())...);
+}
+
+template<typename TResult, typename TA, std::size_t... Ls>
+[[nodiscard]] constexpr TResult
+transpose(const TA& a, std::index_sequence<Ls...>) noexcept
+{
+    constexpr std::array<std::array<std::size_t, 2>, sizeof...(Ls)> gids{TResult::list_to_grid_id(Ls)...};
+    return TResult(a.template at_grid<gids[Ls][1], gids[Ls][0]>()...);
+}
+
+//! std::swap is not constexpr before C++20
+template<typename T, std::size_t N>
+constexpr void
+swap_rows(std::array<T, N>& a, std::array<T, N>& b) noexcept
+{
+    for (std::size_t k = 0; k < N; ++k)
+    {
+        const T tmp = a[k];
+        a[k] = b[k];
+        b[k] = tmp;
+    }
+}
+
+//! in-place LU decomposition with partial pivoting; returns the determinant
+template<typename T, std::size_t N>
+[[nodiscard]] constexpr T
+lu_det(std::array<std::array<T, N>, N> m) noexcept
+{
+    T d = 1;
+
+    for (std::size_t c = 0; c < N; ++c)
+    {
+        std::size_t p = c;
+
+        for (std::size_t r = c + 1; r < N; ++r)
+        {
+            if (linalg_abs(m[r][c]) > linalg_abs(m[p][c]))
+            {
+                p = r;
+            }
+        }
+
+        if (m[p][c] == T(0))
+        {
+            return T(0);
+        }
+
+        if (p != c)
+        {
+            swap_rows(m[p], m[c]);
+            d = -d;
+        }
+
+        d *= m[c][c];
+
+        for (std::size_t r = c + 1; r < N; ++r)
+        {
+            const T f = m[r][c] / m[c][c];
+
+            for (std::size_t k = c; k < N; ++k)
+            {
+                m[r][k] -= f * m[c][k];
+            }
+        }
+    }
+
+    return d;
+}
+
+template<typename T, layout L, std::size_t N>
+[[nodiscard]] constexpr std::array<std::array<T, N>, N>
+to_rows(const basic_array<T, L, N, N>& a) noexcept
+{
+    std::array<std::array<T, N>, N> m{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            m[i][j] = a(i, j);
+        }
+    }
+
+    return m;
+}
+//! 2x2 minors of rows 0 and 1
+template<typename TMatrix>
+[[nodiscard]] constexpr auto
+minors4_upper(const TMatrix& m) noexcept
+{
+    using T = typename TMatrix::value_type;
+
+    return std::array<T, 6>{at<0, 0>(m) * at<1, 1>(m) - at<1, 0>(m) * at<0, 1>(m),
+                            at<0, 0>(m) * at<1, 2>(m) - at<1, 0>(m) * at<0, 2>(m),
+                            at<0, 0>(m) * at<1, 3>(m) - at<1, 0>(m) * at<0, 3>(m),
+                            at<0, 1>(m) * at<1, 2>(m) - at<1, 1>(m) * at<0, 2>(m),
+                            at<0, 1>(m) * at<1, 3>(m) - at<1, 1>(m) * at<0, 3>(m),
+                            at<0, 2>(m) * at<1, 3>(m) - at<1, 2>(m) * at<0, 3>(m)};
+}
+
+//! 2x2 minors of rows 2 and 3, in the order pairing with minors4_upper() in reverse
+template<typename TMatrix>
+[[nodiscard]] constexpr auto
+minors4_lower(const TMatrix& m) noexcept
+{
+    using T = typename TMatrix::value_type;
+
+    return std::array<T, 6>{at<2, 0>(m) * at<3, 1>(m) - at<3, 0>(m) * at<2, 1>(m),
+                            at<2, 0>(m) * at<3, 2>(m) - at<3, 0>(m) * at<2, 2>(m),
+                            at<2, 0>(m) * at<3, 3>(m) - at<3, 0>(m) * at<2, 3>(m),
+                            at<2, 1>(m) * at<3, 2>(m) - at<3, 1>(m) * at<2, 2>(m),
+                            at<2, 1>(m) * at<3, 3>(m) - at<3, 1>(m) * at<2, 3>(m),
+                            at<2, 2>(m) * at<3, 3>(m) - at<3, 2>(m) * at<2, 3>(m)};
+}
+
+//! Gauss-Jordan elimination with partial pivoting
+template<typename T, std::size_t N>
+[[nodiscard]] constexpr std::array<std::array<T, N>, N>
+gauss_jordan_inverse(std::array<std::array<T, N>, N> m) noexcept
+{
+    std::array<std::array<T, N>, N> inv{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        inv[i][i] = T(1);
+    }
+
+    for (std::size_t c = 0; c < N; ++c)
+    {
+        std::size_t p = c;
+
+        for (std::size_t r = c + 1; r < N; ++r)
+        {
+            if (linalg_abs(m[r][c]) > linalg_abs(m[p][c]))
+            {
+                p = r;
+            }
+        }
+
+        swap_rows(m[p], m[c]);
+        swap_rows(inv[p], inv[c]);
+
+        const T f = T(1) / m[c][c];
+
+        for (std::size_t k = 0; k < N; ++k)
+        {
+            m[c][k] *= f;
+            inv[c][k] *= f;
+        }
+
+        for (std::size_t r = 0; r < N; ++r)
+        {
+            if (r != c)
+            {
+                const T g = m[r][c];
+
+                for (std::size_t k = 0; k < N; ++k)
+                {
+                    m[r][k] -= g * m[c][k];
+                    inv[r][k] -= g * inv[c][k];
+                }
+            }
+        }
+    }
+
+    return inv;
+}
+} // namespace detail
+
+//------------------------------------------------------------------------------------------------------
+// products
+//------------------------------------------------------------------------------------------------------
+//! (M x K) * (K x N)
+template<typename T, layout L, std::size_t M, std::size_t K, std::size_t N>
+[[nodiscard]] constexpr basic_array<T, L, M, N>
+matmul(const basic_array<T, L, M, K>& a, const basic_array<T, L, K, N>& b) noexcept
+{
+    return detail::matmul<basic_array<T, L, M, N>, basic_array<T, L, M, K>, basic_array<T, L, K, N>, K>(a, b, std::make_index_sequence<M * N>());
+}
+
+//! (M x N) * N
+template<typename T, layout L, layout LX, std::size_t M, std::size_t N>
+[[nodiscard]] constexpr basic_array<T, LX, M>
+matvec(const basic_array<T, L, M, N>& a, const basic_array<T, LX, N>& x) noexcept
+{
+    return detail::matvec<basic_array<T, LX, M>, basic_array<T, L, M, N>, basic_array<T, LX, N>, N>(a, x, std::make_index_sequence<M>());
+}
+
+template<typename T, layout L, std::size_t M, std::size_t N>
+[[nodiscard]] constexpr basic_array<T, L, N, M>
+transpose(const basic_array<T, L, M, N>& a) noexcept
+{
+    return detail::transpose<basic_array<T, L, N, M>>(a, std::make_index_sequence<M * N>());
+}
+
+template<typename T, std::size_t N, layout L = layout::last_axis_contiguous>
+[[nodiscard]] constexpr basic_array<T, L, N, N>
+identity() noexcept
+{
+    basic_array<T, L, N, N> res{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        res(i, i) = T(1);
+    }
+
+    return res;
+}
+
+//------------------------------------------------------------------------------------------------------
+// determinant / inverse
+//------------------------------------------------------------------------------------------------------
+template<typename T, layout L, std::size_t N>
+[[nodiscard]] constexpr T
+det(const basic_array<T, L, N, N>& m) noexcept
+{
+    using detail::at;
+
+    if constexpr (N == 1)
+    {
+        return at<0, 0>(m);
+    }
+    else if constexpr (N == 2)
+    {
+        return at<0, 0>(m) * at<1, 1>(m) - at<0, 1>(m) * at<1, 0>(m);
+    }
+    else if constexpr (N == 3)
+    {
+        return at<0, 0>(m) * (at<1, 1>(m) * at<2, 2>(m) - at<1, 2>(m) * at<2, 1>(m))
+               - at<0, 1>(m) * (at<1, 0>(m) * at<2, 2>(m) - at<1, 2>(m) * at<2, 0>(m))
+               + at<0, 2>(m) * (at<1, 0>(m) * at<2, 1>(m) - at<1, 1>(m) * at<2, 0>(m));
+    }
+    else if constexpr (N == 4)
+    {
+        const auto s = detail::minors4_upper(m);
+        const auto c = detail::minors4_lower(m);
+
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+    else
+    {
+        static_assert(std::is_floating_point_v<T>, "det() of matrices larger than 4x4 requires floating point values");
+        return detail::lu_det<T, N>(detail::to_rows(m));
+    }
+}
+
+template<typename T, layout L, std::size_t N>
+[[nodiscard]] constexpr basic_array<T, L, N, N>
+inverse(const basic_array<T, L, N, N>& m) noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "inverse() requires floating point values");
+
+    using detail::at;
+
+    basic_array<T, L, N, N> r{};
+
+    if constexpr (N == 1)
+    {
+        at<0, 0>(r) = T(1) / at<0, 0>(m);
+    }
+    else if constexpr (N == 2)
+    {
+        const T f = T(1) / det(m);
+
+        at<0, 0>(r) = f * at<1, 1>(m);
+        at<0, 1>(r) = -f * at<0, 1>(m);
+        at<1, 0>(r) = -f * at<1, 0>(m);
+        at<1, 1>(r) = f * at<0, 0>(m);
+    }
+    else if constexpr (N == 3)
+    {
+        // adjugate
+        at<0, 0>(r) = at<1, 1>(m) * at<2, 2>(m) - at<1, 2>(m) * at<2, 1>(m);
+        at<0, 1>(r) = at<0, 2>(m) * at<2, 1>(m) - at<0, 1>(m) * at<2, 2>(m);
+        at<0, 2>(r) = at<0, 1>(m) * at<1, 2>(m) - at<0, 2>(m) * at<1, 1>(m);
+        at<1, 0>(r) = at<1, 2>(m) * at<2, 0>(m) - at<1, 0>(m) * at<2, 2>(m);
+        at<1, 1>(r) = at<0, 0>(m) * at<2, 2>(m) - at<0, 2>(m) * at<2, 0>(m);
+        at<1, 2>(r) = at<0, 2>(m) * at<1, 0>(m) - at<0, 0>(m) * at<1, 2>(m);
+        at<2, 0>(r) = at<1, 0>(m) * at<2, 1>(m) - at<1, 1>(m) * at<2, 0>(m);
+        at<2, 1>(r) = at<0, 1>(m) * at<2, 0>(m) - at<0, 0>(m) * at<2, 1>(m);
+        at<2, 2>(r) = at<0, 0>(m) * at<1, 1>(m) - at<0, 1>(m) * at<1, 0>(m);
+
+        const T f = T(1) / (at<0, 0>(m) * at<0, 0>(r) + at<0, 1>(m) * at<1, 0>(r) + at<0, 2>(m) * at<2, 0>(r));
+
+        for (std::size_t i = 0; i < r.num_values(); ++i)
+        {
+            r[i] *= f;
+        }
+    }
+    else if constexpr (N == 4)
+    {
+        const auto s = detail::minors4_upper(m);
+        const auto c = detail::minors4_lower(m);
+
+        // adjugate from the 2x2 minors
+        at<0, 0>(r) = at<1, 1>(m) * c[5] - at<1, 2>(m) * c[4] + at<1, 3>(m) * c[3];
+        at<0, 1>(r) = -at<0, 1>(m) * c[5] + at<0, 2>(m) * c[4] - at<0, 3>(m) * c[3];
+        at<0, 2>(r) = at<3, 1>(m) * s[5] - at<3, 2>(m) * s[4] + at<3, 3>(m) * s[3];
+        at<0, 3>(r) = -at<2, 1>(m) * s[5] + at<2, 2>(m) * s[4] - at<2, 3>(m) * s[3];
+        at<1, 0>(r) = -at<1, 0>(m) * c[5] + at<1, 2>(m) * c[2] - at<1, 3>(m) * c[1];
+        at<1, 1>(r) = at<0, 0>(m) * c[5] - at<0, 2>(m) * c[2] + at<0, 3>(m) * c[1];
+        at<1, 2>(r) = -at<3, 0>(m) * s[5] + at<3, 2>(m) * s[2] - at<3, 3>(m) * s[1];
+        at<1, 3>(r) = at<2, 0>(m) * s[5] - at<2, 2>(m) * s[2] + at<2, 3>(m) * s[1];
+        at<2, 0>(r) = at<1, 0>(m) * c[4] - at<1, 1>(m) * c[2] + at<1, 3>(m) * c[0];
+        at<2, 1>(r) = -at<0, 0>(m) * c[4] + at<0, 1>(m) * c[2] - at<0, 3>(m) * c[0];
+        at<2, 2>(r) = at<3, 0>(m) * s[4] - at<3, 1>(m) * s[2] + at<3, 3>(m) * s[0];
+        at<2, 3>(r) = -at<2, 0>(m) * s[4] + at<2, 1>(m) * s[2] - at<2, 3>(m) * s[0];
+        at<3, 0>(r) = -at<1, 0>(m) * c[3] + at<1, 1>(m) * c[1] - at<1, 2>(m) * c[0];
+        at<3, 1>(r) = at<0, 0>(m) * c[3] - at<0, 1>(m) * c[1] + at<0, 2>(m) * c[0];
+        at<3, 2>(r) = -at<3, 0>(m) * s[3] + at<3, 1>(m) * s[1] - at<3, 2>(m) * s[0];
+        at<3, 3>(r) = at<2, 0>(m) * s[3] - at<2, 1>(m) * s[1] + at<2, 2>(m) * s[0];
+
+        const T f = T(1) / (s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0]);
+
+        for (std::size_t i = 0; i < r.num_values(); ++i)
+        {
+            r[i] *= f;
+        }
+    }
+    else
+    {
+        const auto inv = detail::gauss_jordan_inverse<T, N>(detail::to_rows(m));
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < N; ++j)
+            {
+                r(i, j) = inv[i][j];
+            }
+        }
+    }
+
+    return r;
+}
+
+//------------------------------------------------------------------------------------------------------
+// symmetric eigen decomposition
+//------------------------------------------------------------------------------------------------------
+template<typename T, layout L, std::size_t N>
+struct symmetric_eigen_result
+{
+    basic_array<T, L, N>    values;  //!< ascending
+    basic_array<T, L, N, N> vectors; //!< column j belongs to values[j]
+};
+
+//! eigenvalues / -vectors of a symmetric matrix via cyclic Jacobi rotations; only the upper triangle is read
+template<typename T, layout L, std::size_t N>
+[[nodiscard]] constexpr symmetric_eigen_result<T, L, N>
+symmetric_eigen(const basic_array<T, L, N, N>& m, std::size_t maxSweeps = 32) noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "symmetric_eigen() requires floating point values");
+
+    using detail::linalg_abs;
+    using detail::linalg_sqrt;
+
+    std::array<std::array<T, N>, N> a{};
+    std::array<std::array<T, N>, N> v{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            a[i][j] = i <= j ? m(i, j) : m(j, i);
+            v[i][j] = i == j ? T(1) : T(0);
+        }
+    }
+
+    for (std::size_t sweep = 0; sweep < maxSweeps; ++sweep)
+    {
+        T off  = 0;
+        T diag = 0;
+
+        for (std::size_t p = 0; p < N; ++p)
+        {
+            diag += a[p][p] * a[p][p];
+
+            for (std::size_t q = p + 1; q < N; ++q)
+            {
+                off += a[p][q] * a[p][q];
+            }
+        }
+
+        if (!(off > std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * diag))
+        {
+            break;
+        }
+
+        for (std::size_t p = 0; p + 1 < N; ++p)
+        {
+            for (std::size_t q = p + 1; q < N; ++q)
+            {
+                const T apq = a[p][q];
+
+                if (apq == T(0))
+                {
+                    continue;
+                }
+
+                // rotation angle that zeroes a[p][q]; t = tan, smaller root for stability
+                const T theta = (a[q][q] - a[p][p]) / (2 * apq);
+                const T t     = linalg_abs(theta) > T(1) / std::numeric_limits<T>::epsilon()
+                                ? T(1) / (2 * theta)
+                                : (theta < 0 ? T(-1) : T(1)) / (linalg_abs(theta) + linalg_sqrt(theta * theta + 1));
+                const T c     = T(1) / linalg_sqrt(t * t + 1);
+                const T s     = t * c;
+
+                a[p][p] -= t * apq;
+                a[q][q] += t * apq;
+                a[p][q] = a[q][p] = 0;
+
+                for (std::size_t r = 0; r < N; ++r)
+                {
+                    if (r != p && r != q)
+                    {
+                        const T arp = a[r][p];
+                        const T arq = a[r][q];
+
+                        a[r][p] = a[p][r] = c * arp - s * arq;
+                        a[r][q] = a[q][r] = s * arp + c * arq;
+                    }
+
+                    const T vrp = v[r][p];
+                    const T vrq = v[r][q];
+
+                    v[r][p] = c * vrp - s * vrq;
+                    v[r][q] = s * vrp + c * vrq;
+                }
+            }
+        }
+    }
+
+    // selection sort by eigenvalue
+    std::array<std::size_t, N> order{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        order[i] = i;
+    }
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::size_t k = i;
+
+        for (std::size_t j = i + 1; j < N; ++j)
+        {
+            if (a[order[j]][order[j]] < a[order[k]][order[k]])
+            {
+                k = j;
+            }
+        }
+
+        const std::size_t tmp = order[i];
+        order[i] = order[k];
+        order[k] = tmp;
+    }
+
+    symmetric_eigen_result<T, L, N> res{};
+
+    for (std::size_t j = 0; j < N; ++j)
+    {
+        res.values[j] = a[order[j]][order[j]];
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            res.vectors(i, j) = v[i][order[j]];
+        }
+    }
+
+    return res;
+}
+} // namespace nd
+
+#endif //__ND_LINALG_H__z5x9c3v7b1n5m9q3w7e1r5t9y3u7i1
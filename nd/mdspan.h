@@ -0,0 +1,456 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_MDSPAN_H__a9s3d7f1g5h9j3k7l1z5x9c3v7b1n5
+#define __ND_MDSPAN_H__a9s3d7f1g5h9j3k7l1z5x9c3v7b1n5
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<version>)
+  #include <version>
+#endif
+
+#if defined(__cpp_lib_span)
+  #include <span>
+  #define ND_STD_SPAN
+#endif
+
+#if defined(__cpp_lib_mdspan)
+  #include <mdspan>
+  #define ND_STD_MDSPAN
+#endif
+
+#include "extents.h"
+#include "layout.h"
+
+//====================================================================================================
+//===== span / mdspan
+//====================================================================================================
+/*
+ * zero-copy views used by as_span() / as_mdspan() of nd::array, nd::grid and nd::vector:
+ *
+ *     void smooth(nd::span<float> values);
+ *     smooth(g.as_span());
+ *
+ *     auto m = g.as_mdspan();                           // nd::mdspan< float, nd::dextents< 3 >, nd::layout_right >
+ *     auto v = nd::as_mdspan(nd::span<float>(p, n), nd::md_extents<nd::dyn, 3>(n / 3));
+ *
+ * - nd::span / nd::mdspan / nd::layout_right / nd::layout_left are the standard types if the standard library
+ *   provides them (__cpp_lib_span, __cpp_lib_mdspan), otherwise the bundled fallbacks below
+ * - the fallback mdspan supports the constructors, extents(), extent(), stride(), size(), data_handle() of
+ *   std::mdspan; since C++17 has no multi-argument operator[], elements are accessed via operator()(i, j, ...)
+ *   or operator[](index array)
+ * - nd::md_at(m, i, j, ...) / nd::md_at(m, std::array{...}) access elements of both, e.g., nd::md_at(m, 1, 2, 3) = 0
+ */
+namespace nd
+{
+//------------------------------------------------------------------------------------------------------
+// span
+//------------------------------------------------------------------------------------------------------
+#ifdef ND_STD_SPAN
+template<typename T>
+using span = std::span<T>;
+#else
+//! contiguous range of values (fallback for std::span with dynamic extent)
+template<typename T>
+class span
+{
+  public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+  private:
+    T*          _data = nullptr;
+    std::size_t _size = 0;
+
+  public:
+    constexpr span() noexcept = default;
+
+    constexpr span(T* data, std::size_t size) noexcept :
+        _data(data)
+        , _size(size)
+    {
+    }
+
+    //! from contiguous containers such as std::vector or std::array
+    template<typename TContainer, std::enable_if_t<std::is_convertible_v<decltype(std::declval<TContainer&>().data()), T*>>* = nullptr>
+    constexpr span(TContainer& c) noexcept :
+        _data(c.data())
+        , _size(c.size())
+    {
+    }
+
+    template<typename U, std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>* = nullptr>
+    constexpr span(const span<U>& other) noexcept :
+        _data(other.data())
+        , _size(other.size())
+    {
+    }
+
+    [[nodiscard]] constexpr T*
+    data() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    size_bytes() const noexcept
+    {
+        return _size * sizeof(T);
+    }
+
+    [[nodiscard]] constexpr bool
+    empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] constexpr T&
+    operator[](std::size_t i) const noexcept
+    {
+        assert(i < _size && "id out of bounds");
+        return _data[i];
+    }
+
+    [[nodiscard]] constexpr T&
+    front() const noexcept
+    {
+        return _data[0];
+    }
+
+    [[nodiscard]] constexpr T&
+    back() const noexcept
+    {
+        return _data[_size - 1];
+    }
+
+    [[nodiscard]] constexpr T*
+    begin() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] constexpr T*
+    end() const noexcept
+    {
+        return _data + _size;
+    }
+
+    [[nodiscard]] constexpr span
+    first(std::size_t n) const noexcept
+    {
+        assert(n <= _size);
+        return span(_data, n);
+    }
+
+    [[nodiscard]] constexpr span
+    last(std::size_t n) const noexcept
+    {
+        assert(n <= _size);
+        return span(_data + _size - n, n);
+    }
+
+    [[nodiscard]] constexpr span
+    subspan(std::size_t offset, std::size_t count = static_cast<std::size_t>(-1)) const noexcept
+    {
+        assert(offset <= _size);
+        return span(_data + offset, count == static_cast<std::size_t>(-1) ? _size - offset : count);
+    }
+};
+#endif // ND_STD_SPAN
+
+//------------------------------------------------------------------------------------------------------
+// mdspan
+//------------------------------------------------------------------------------------------------------
+#ifdef ND_STD_MDSPAN
+template<std::size_t... TExtents>
+using md_extents = std::extents<std::size_t, TExtents...>;
+
+template<std::size_t N>
+using dextents = std::dextents<std::size_t, N>;
+
+using layout_right = std::layout_right;
+using layout_left = std::layout_left;
+
+template<typename T, typename TExtents, typename TLayoutPolicy = layout_right>
+using mdspan = std::mdspan<T, TExtents, TLayoutPolicy>;
+#else
+template<std::size_t... TExtents>
+using md_extents = extents<TExtents...>;
+
+namespace detail
+{
+template<typename TSequence>
+struct dextents_of;
+
+template<std::size_t... Is>
+struct dextents_of<std::index_sequence<Is...>>
+{
+    using type = extents<(static_cast<void>(Is), dyn)...>;
+};
+} // namespace detail
+
+//! extents of rank N that are all dynamic
+template<std::size_t N>
+using dextents = typename detail::dextents_of<std::make_index_sequence<N>>::type;
+
+//! last index contiguous ("row major")
+struct layout_right
+{
+};
+
+//! first index contiguous ("column major")
+struct layout_left
+{
+};
+
+//! non-owning view of a multidimensional array (fallback for std::mdspan)
+template<typename T, typename TExtents, typename TLayoutPolicy = layout_right>
+class mdspan
+{
+    static_assert(std::is_same_v<TLayoutPolicy, layout_right> || std::is_same_v<TLayoutPolicy, layout_left>, "unsupported layout policy");
+
+  public:
+    using extents_type = TExtents;
+    using layout_type = TLayoutPolicy;
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using index_type = typename extents_type::size_type;
+    using size_type = std::size_t;
+    using data_handle_type = T*;
+    using reference = T&;
+
+    [[nodiscard]] static constexpr std::size_t
+    rank() noexcept
+    {
+        return extents_type::rank();
+    }
+
+    [[nodiscard]] static constexpr std::size_t
+    rank_dynamic() noexcept
+    {
+        return extents_type::rank_dynamic();
+    }
+
+    [[nodiscard]] static constexpr std::size_t
+    static_extent(std::size_t k) noexcept
+    {
+        return extents_type::static_extent(k);
+    }
+
+  private:
+    T*                                _data = nullptr;
+    extents_type                      _extents;
+    std::array<std::size_t, rank()>   _strides{};
+
+  public:
+    constexpr mdspan() noexcept = default;
+
+    constexpr mdspan(T* data, const extents_type& e) noexcept :
+        _data(data)
+        , _extents(e)
+    {
+        std::size_t s = 1;
+
+        for (std::size_t i = 0; i < rank(); ++i)
+        {
+            const std::size_t k = std::is_same_v<TLayoutPolicy, layout_right> ? rank() - 1 - i : i;
+
+            _strides[k] = s;
+            s *= _extents.extent(k);
+        }
+    }
+
+    //! the dynamic extents or all extents
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) != 0 && std::conjunction_v<std::is_integral<TSizes>...>>* = nullptr>
+    constexpr explicit mdspan(T* data, TSizes... sizes) noexcept :
+        mdspan(data, extents_type(sizes...))
+    {
+    }
+
+    //! e.g., mdspan< float, ... > -> mdspan< const float, ... >
+    template<typename U, std::enable_if_t<!std::is_same_v<U, T> && std::is_convertible_v<U (*)[], T (*)[]>>* = nullptr>
+    constexpr mdspan(const mdspan<U, TExtents, TLayoutPolicy>& other) noexcept :
+        mdspan(other.data_handle(), other.extents())
+    {
+    }
+
+    [[nodiscard]] constexpr const extents_type&
+    extents() const noexcept
+    {
+        return _extents;
+    }
+
+    [[nodiscard]] constexpr index_type
+    extent(std::size_t k) const noexcept
+    {
+        return _extents.extent(k);
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    stride(std::size_t k) const noexcept
+    {
+        return _strides[k];
+    }
+
+    [[nodiscard]] constexpr std::size_t
+    size() const noexcept
+    {
+        std::size_t n = 1;
+
+        for (std::size_t k = 0; k < rank(); ++k)
+        {
+            n *= _extents.extent(k);
+        }
+
+        return n;
+    }
+
+    [[nodiscard]] constexpr bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]] constexpr T*
+    data_handle() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] static constexpr bool
+    is_exhaustive() noexcept
+    {
+        return true;
+    }
+
+    [[nodiscard]] static constexpr bool
+    is_strided() noexcept
+    {
+        return true;
+    }
+
+  private:
+    template<std::size_t... Is, typename... Ids>
+    [[nodiscard]] constexpr std::size_t
+    _offset(std::index_sequence<Is...>, const Ids& ... ids) const noexcept
+    {
+        assert(((static_cast<std::size_t>(ids) < _extents.extent(Is)) && ...) && "id out of bounds");
+        return (std::size_t(0) + ... + (static_cast<std::size_t>(ids) * _strides[Is]));
+    }
+
+  public:
+    template<typename... Ids, std::enable_if_t<sizeof...(Ids) == rank() && std::conjunction_v<std::is_integral<Ids>...>>* = nullptr>
+    [[nodiscard]] constexpr T&
+    operator()(const Ids& ... ids) const noexcept
+    {
+        return _data[_offset(std::make_index_sequence<rank()>(), ids...)];
+    }
+
+    //! element at an index[]-accessible position, e.g., std::array< std::size_t, rank() >
+    template<typename TIndexAccessible, std::enable_if_t<!std::is_integral_v<TIndexAccessible>>* = nullptr>
+    [[nodiscard]] constexpr T&
+    operator[](const TIndexAccessible& gid) const noexcept
+    {
+        std::size_t offset = 0;
+
+        for (std::size_t k = 0; k < rank(); ++k)
+        {
+            assert(static_cast<std::size_t>(gid[k]) < _extents.extent(k) && "id out of bounds");
+            offset += static_cast<std::size_t>(gid[k]) * _strides[k];
+        }
+
+        return _data[offset];
+    }
+};
+#endif // ND_STD_MDSPAN
+
+//! element (i, j, ...) of an nd::mdspan; same call for std::mdspan (m[i, j, ...]) and the fallback (m(i, j, ...))
+template<typename TMdspan, typename... Ids, std::enable_if_t<sizeof...(Ids) == TMdspan::rank() && std::conjunction_v<std::is_integral<Ids>...>>* = nullptr>
+[[nodiscard]] constexpr typename TMdspan::reference
+md_at(const TMdspan& m, const Ids& ... ids) noexcept
+{
+#ifdef ND_STD_MDSPAN
+    return m[static_cast<typename TMdspan::index_type>(ids)...];
+#else
+    return m(ids...);
+#endif
+}
+
+//! element of an nd::mdspan at a position given as std::array< I, rank() >
+template<typename TMdspan, typename I>
+[[nodiscard]] constexpr typename TMdspan::reference
+md_at(const TMdspan& m, const std::array<I, TMdspan::rank()>& gid) noexcept
+{
+    return m[gid];
+}
+
+namespace detail
+{
+//! mdspan layout policy of an nd::layout
+template<layout TLayout>
+using mdspan_layout_t = std::conditional_t<TLayout == layout::last_axis_contiguous, layout_right, layout_left>;
+} // namespace detail
+
+//! view of a span with the given extents; throws std::invalid_argument if the number of values does not match
+template<typename TLayoutPolicy = layout_right, typename T, typename TExtents>
+[[nodiscard]] mdspan<T, TExtents, TLayoutPolicy>
+as_mdspan(span<T> values, const TExtents& e)
+{
+    std::size_t n = 1;
+
+    for (std::size_t k = 0; k < TExtents::rank(); ++k)
+    {
+        n *= static_cast<std::size_t>(e.extent(k));
+    }
+
+    if (n != values.size())
+    {
+        throw std::invalid_argument("as_mdspan: extents describe " + std::to_string(n) + " values, span has " + std::to_string(values.size()));
+    }
+
+    return mdspan<T, TExtents, TLayoutPolicy>(values.data(), e);
+}
+} // namespace nd
+
+#endif //__ND_MDSPAN_H__a9s3d7f1g5h9j3k7l1z5x9c3v7b1n5
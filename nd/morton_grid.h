@@ -0,0 +1,902 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_MORTON_GRID_H__p5o9i3u7y1t5r9e3w7q1a5s9d3f7g1
+#define __ND_MORTON_GRID_H__p5o9i3u7y1t5r9e3w7q1a5s9d3f7g1
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__BMI2__)
+  #include <immintrin.h>
+  #define ND_MORTON_BMI2
+#endif
+
+#include "grid.h"
+#include "parallel.h"
+
+//====================================================================================================
+//===== class morton_grid
+//====================================================================================================
+/*
+ * N-dimensional grid stored in Morton (Z-) order:
+ *
+ *     nd::morton_grid<float, 3> m(nd_grid_3d); // converts from a row-major nd::grid
+ *     m(x, y, z) = 1;
+ *     const auto right = m.neighbor(m.grid_to_list_id(x, y, z), 0, +1); // list id of (x+1, y, z)
+ *
+ * - the bits of the coordinates are interleaved starting with dimension 0 at bit 0. Each dimension contributes
+ *   only as many bits as its size requires, so non-cubic sizes need at most 2^N times the number of values
+ *   (padding) instead of the bounding power-of-two cube
+ * - coordinates are interleaved via pdep / pext if BMI2 is available (compile with -mbmi2 or -march=native)
+ *   and via per-dimension lookup tables of 256 entries per byte of a coordinate otherwise
+ * - neighbor() moves along one dimension in O(1) via dilated integer arithmetic without decoding the list id
+ * - begin() / end() iterate over all values in Morton order and skip padding; it.grid_id() returns the position
+ */
+namespace nd
+{
+namespace detail
+{
+[[nodiscard]] inline unsigned int
+soft_pdep(unsigned int x, unsigned int mask) noexcept
+{
+    unsigned int res = 0;
+
+    for (unsigned int bit = 1; mask != 0; bit <<= 1)
+    {
+        if ((x & bit) != 0)
+        {
+            res |= mask & (~mask + 1U);
+        }
+
+        mask &= mask - 1;
+    }
+
+    return res;
+}
+
+[[nodiscard]] inline unsigned int
+soft_pext(unsigned int x, unsigned int mask) noexcept
+{
+    unsigned int res = 0;
+
+    for (unsigned int bit = 1; mask != 0; bit <<= 1)
+    {
+        if ((x & mask & (~mask + 1U)) != 0)
+        {
+            res |= bit;
+        }
+
+        mask &= mask - 1;
+    }
+
+    return res;
+}
+} // namespace detail
+
+template<typename TValue, std::size_t TDimensions>
+class morton_grid
+{
+    //------------------------------------------------------------------------------------------------------
+    // assertions
+    //------------------------------------------------------------------------------------------------------
+    static_assert(TDimensions > 0, "template num dimension must be greater than 0");
+    static_assert(sizeof(unsigned int) == 4, "morton codes are 32 bit");
+
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] static constexpr std::size_t
+    num_dimensions() noexcept
+    {
+        return TDimensions;
+    }
+
+    using self_type = morton_grid<TValue, TDimensions>;
+    using value_type = TValue;
+    using data_container_type = std::vector<value_type>;
+    using size_type = unsigned int;
+    using difference_type = int;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using grid_id_type = std::array<size_type, TDimensions>;
+
+    //------------------------------------------------------------------------------------------------------
+    // iterator
+    //------------------------------------------------------------------------------------------------------
+  private:
+    //! visits all values in Morton order, skipping padding
+    template<bool IsConst>
+    class _morton_iterator
+    {
+        friend class morton_grid;
+        template<bool> friend class _morton_iterator;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename morton_grid::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+      private:
+        using grid_pointer = std::conditional_t<IsConst, const morton_grid*, morton_grid*>;
+
+        grid_pointer _grid = nullptr;
+        size_type    _lid  = 0;
+
+        _morton_iterator(grid_pointer g, size_type lid) :
+            _grid(g)
+            , _lid(lid)
+        {
+        }
+
+      public:
+        _morton_iterator() = default;
+
+        //! converts iterator to const_iterator
+        template<bool C = IsConst, std::enable_if_t<C>* = nullptr>
+        _morton_iterator(const _morton_iterator<false>& other) :
+            _grid(other._grid)
+            , _lid(other._lid)
+        {
+        }
+
+        [[nodiscard]] reference
+        operator*() const
+        {
+            return _grid->_values[_lid];
+        }
+
+        [[nodiscard]] pointer
+        operator->() const
+        {
+            return &_grid->_values[_lid];
+        }
+
+        _morton_iterator&
+        operator++() noexcept
+        {
+            const auto n = static_cast<size_type>(_grid->_values.size());
+
+            do
+            { ++_lid; } while (_lid < n && !_grid->_is_inside(_lid));
+
+            return *this;
+        }
+
+        _morton_iterator
+        operator++(int) noexcept
+        {
+            _morton_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        //! position of the current value in the grid
+        [[nodiscard]] grid_id_type
+        grid_id() const noexcept
+        {
+            return _grid->list_to_grid_id(_lid);
+        }
+
+        //! index of the current value in data()
+        [[nodiscard]] size_type
+        list_id() const noexcept
+        {
+            return _lid;
+        }
+
+        [[nodiscard]] bool
+        operator==(const _morton_iterator& other) const noexcept
+        {
+            return _lid == other._lid;
+        }
+
+        [[nodiscard]] bool
+        operator!=(const _morton_iterator& other) const noexcept
+        {
+            return _lid != other._lid;
+        }
+    };
+
+  public:
+    using iterator = _morton_iterator<false>;
+    using const_iterator = _morton_iterator<true>;
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    grid_id_type              _sizes{};
+    grid_id_type              _masks{};         // bits of the list id that belong to each dimension
+    grid_id_type              _dilated_max{};   // size - 1 spread to the bits of _masks
+    std::vector<unsigned int> _tables;          // pdep lookup tables: dimension, byte of coordinate, byte value
+    size_type                 _num_table_bytes = 0;
+    data_container_type       _values;
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    morton_grid() = default;
+
+    morton_grid(const self_type&) = default;
+
+    morton_grid(self_type&&) noexcept = default;
+
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) == TDimensions && std::conjunction_v<std::is_integral<std::decay_t<TSizes>>...>>* = nullptr>
+    explicit morton_grid(TSizes... sizes)
+    {
+        resize({static_cast<size_type>(sizes)...}, value_type());
+    }
+
+    template<typename TIndex>
+    morton_grid(std::initializer_list<TIndex> sizes, const value_type& defaultInitValue = value_type())
+    {
+        resize(sizes, defaultInitValue);
+    }
+
+    //! copies a row-major grid tile by tile so that reads and writes stay within a few cache lines / pages
+    /*!
+     * numThreads == 0 picks the number of threads from the hardware and the grid size.
+     */
+    template<typename K>
+    explicit morton_grid(const grid<K, TDimensions>& g, unsigned int numThreads = 0)
+    {
+        static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
+
+        if (g.empty())
+        {
+            return;
+        }
+
+        resize(g.size().begin(), g.size().end(), value_type());
+
+        const K* src = g.data().data();
+
+        _for_each_row(g.strides(), numThreads, [&](size_type lid, size_type gridLid, size_type n)
+        {
+            for (size_type i = 0; i < n; ++i, lid = _dilated_increment(lid, TDimensions - 1))
+            {
+                _values[lid] = static_cast<value_type>(src[gridLid + i]);
+            }
+        });
+    }
+
+    ~morton_grid() = default;
+
+    self_type&
+    operator=(const self_type&) = default;
+
+    self_type&
+    operator=(self_type&&) noexcept = default;
+
+    //------------------------------------------------------------------------------------------------------
+    // conversion to grid
+    //------------------------------------------------------------------------------------------------------
+    //! copies the values to a row-major grid tile by tile
+    template<typename K = value_type>
+    [[nodiscard]] grid<K, TDimensions>
+    to_grid(unsigned int numThreads = 0) const
+    {
+        static_assert(std::is_convertible_v<value_type, K>, "cannot cast types");
+
+        grid<K, TDimensions> g;
+
+        if (empty())
+        {
+            return g;
+        }
+
+        g.resize(_sizes.begin(), _sizes.end(), K());
+
+        K* dst = g.data().data();
+
+        _for_each_row(g.strides(), numThreads, [&](size_type lid, size_type gridLid, size_type n)
+        {
+            for (size_type i = 0; i < n; ++i, lid = _dilated_increment(lid, TDimensions - 1))
+            {
+                dst[gridLid + i] = static_cast<K>(_values[lid]);
+            }
+        });
+
+        return g;
+    }
+
+  private:
+    //! calls f(list id, grid list id, n) for rows of n values along the last dimension
+    /*!
+     * rows are grouped into tiles of 16^N values (at most 64 values along the last dimension)
+     * that are aligned to the Morton blocks; tiles are distributed over the threads
+     */
+    template<typename TFunction>
+    void
+    _for_each_row(const grid_id_type& gridStrides, unsigned int numThreads, TFunction&& f) const
+    {
+        constexpr size_type tileShift     = 4;
+        constexpr size_type lastTileShift = TDimensions == 1 ? 16 : (TDimensions == 2 ? 6 : tileShift);
+
+        grid_id_type numTiles{};
+        grid_id_type tileStrides{};
+        std::size_t  numTilesTotal = 1;
+
+        for (size_type k = TDimensions; k-- > 0;)
+        {
+            const size_type shift = k == TDimensions - 1 ? lastTileShift : tileShift;
+
+            numTiles[k]    = ((_sizes[k] - 1) >> shift) + 1;
+            tileStrides[k] = static_cast<size_type>(numTilesTotal);
+            numTilesTotal *= numTiles[k];
+        }
+
+        numThreads = detail::num_threads(numThreads, _values.size() * sizeof(value_type));
+
+        detail::parallel_for_range(numThreads, numTilesTotal, [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t t = first; t < last; ++t)
+            {
+                grid_id_type origin{};
+                grid_id_type limits{};
+                std::size_t  rest = t;
+
+                for (size_type k = 0; k < TDimensions; ++k)
+                {
+                    const size_type shift = k == TDimensions - 1 ? lastTileShift : tileShift;
+                    const size_type tile  = static_cast<size_type>(rest / tileStrides[k]);
+                    rest -= tile * static_cast<std::size_t>(tileStrides[k]);
+
+                    origin[k] = tile << shift;
+                    limits[k] = std::min(size_type(1) << shift, _sizes[k] - origin[k]);
+                }
+
+                // odometer over the rows of the tile, i.e., dimensions 0, ..., N-2
+                grid_id_type gid = origin;
+
+                for (;;)
+                {
+                    f(grid_to_list_id(gid), _row_major_list_id(gid, gridStrides), limits[TDimensions - 1]);
+
+                    size_type k = TDimensions - 1;
+
+                    while (k-- > 0)
+                    {
+                        if (++gid[k] < origin[k] + limits[k])
+                        {
+                            break;
+                        }
+
+                        gid[k] = origin[k];
+                    }
+
+                    if (k == static_cast<size_type>(-1))
+                    {
+                        break;
+                    }
+                }
+            }
+        });
+    }
+
+    [[nodiscard]] static size_type
+    _row_major_list_id(const grid_id_type& gid, const grid_id_type& strides) noexcept
+    {
+        size_type lid = 0;
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            lid += gid[k] * strides[k];
+        }
+
+        return lid;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // bit interleaving
+    //------------------------------------------------------------------------------------------------------
+    //! spreads the bits of coordinate x of dimension dimId to the bits of _masks[dimId]
+    [[nodiscard]] size_type
+    _dilate(size_type x, size_type dimId) const noexcept
+    {
+#ifdef ND_MORTON_BMI2
+        return _pdep_u32(x, _masks[dimId]);
+#else
+        const unsigned int* table = _tables.data() + std::size_t(dimId) * _num_table_bytes * 256U;
+        size_type           res   = 0;
+
+        for (size_type b = 0; b < _num_table_bytes; ++b, x >>= 8, table += 256)
+        {
+            res |= table[x & 0xFFU];
+        }
+
+        return res;
+#endif
+    }
+
+    [[nodiscard]] size_type
+    _undilate(size_type lid, size_type dimId) const noexcept
+    {
+#ifdef ND_MORTON_BMI2
+        return _pext_u32(lid, _masks[dimId]);
+#else
+        return detail::soft_pext(lid, _masks[dimId]);
+#endif
+    }
+
+    //! list id of the next position along dimension dimId
+    [[nodiscard]] size_type
+    _dilated_increment(size_type lid, size_type dimId) const noexcept
+    {
+        const size_type m = _masks[dimId];
+        return (((lid | ~m) + 1U) & m) | (lid & ~m);
+    }
+
+    [[nodiscard]] bool
+    _is_inside(size_type lid) const noexcept
+    {
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            // pdep preserves the order, so the comparison works on the dilated coordinates
+            if ((lid & _masks[k]) > _dilated_max[k])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // sizes
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] const grid_id_type&
+    size() const noexcept
+    {
+        return _sizes;
+    }
+
+    [[nodiscard]] size_type
+    size(size_type dimId) const
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _sizes[dimId];
+    }
+
+    //! number of values excluding padding
+    [[nodiscard]] size_type
+    num_values() const noexcept
+    {
+        size_type n = 1;
+
+        for (size_type s: _sizes)
+        {
+            n *= s;
+        }
+
+        return n;
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return _values.empty();
+    }
+
+    //! bits of a list id that hold the coordinate of dimension dimId
+    [[nodiscard]] size_type
+    dimension_mask(size_type dimId) const
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _masks[dimId];
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // data
+    //------------------------------------------------------------------------------------------------------
+    //! Morton-ordered storage incl. padding
+    [[nodiscard]] data_container_type&
+    data() & noexcept
+    {
+        return _values;
+    }
+
+    [[nodiscard]] const data_container_type&
+    data() const& noexcept
+    {
+        return _values;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // list id / grid id conversion
+    //------------------------------------------------------------------------------------------------------
+  private:
+    template<std::size_t... Is, typename... Ids>
+    [[nodiscard]] size_type
+    _grid_to_list_id_pack(std::index_sequence<Is...>, Ids... ids) const noexcept
+    {
+        return (0U | ... | _dilate(static_cast<size_type>(ids), Is));
+    }
+
+  public:
+    //! Morton code, i.e., index in data(), of the given grid position
+    template<typename... Ids>
+    [[nodiscard]] size_type
+    grid_to_list_id(const Ids& ... ids) const
+    {
+        constexpr bool isIndexPack = sizeof...(Ids) == TDimensions && std::conjunction_v<std::is_integral<Ids>...>;
+
+        static_assert(isIndexPack || sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+        if constexpr (isIndexPack)
+        {
+            return _grid_to_list_id_pack(std::make_index_sequence<TDimensions>(), ids...);
+        }
+        else
+        {
+            const auto& gid = std::get<0>(std::forward_as_tuple(ids...));
+            size_type   lid = 0;
+
+            for (size_type k = 0; k < TDimensions; ++k)
+            {
+                lid |= _dilate(static_cast<size_type>(gid[k]), k);
+            }
+
+            return lid;
+        }
+    }
+
+    [[nodiscard]] grid_id_type
+    list_to_grid_id(size_type lid) const noexcept
+    {
+        grid_id_type gid{};
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            gid[k] = _undilate(lid, k);
+        }
+
+        return gid;
+    }
+
+    //! list id of the value delta steps away along dimension dimId in O(1)
+    /*!
+     * the neighbour must be inside the grid
+     */
+    [[nodiscard]] size_type
+    neighbor(size_type lid, size_type dimId, int delta) const noexcept
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+
+        const size_type m = _masks[dimId];
+
+        if (delta >= 0)
+        {
+            const size_type d = delta == 1 ? (m & (~m + 1U)) : _dilate(static_cast<size_type>(delta), dimId);
+            return (((lid | ~m) + d) & m) | (lid & ~m);
+        }
+
+        const size_type d = delta == -1 ? (m & (~m + 1U)) : _dilate(static_cast<size_type>(-delta), dimId);
+        return (((lid & m) - d) & m) | (lid & ~m);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // access
+    //------------------------------------------------------------------------------------------------------
+    template<typename... Ids>
+    [[nodiscard]] bool
+    is_valid_ids(const Ids& ... ids) const
+    {
+        if constexpr (sizeof...(Ids) == TDimensions)
+        {
+            size_type k = 0;
+            return ((ids >= 0 && static_cast<size_type>(ids) < _sizes[k++]) && ...);
+        }
+        else
+        {
+            static_assert(sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+            const auto& gid = std::get<0>(std::forward_as_tuple(ids...));
+
+            for (size_type k = 0; k < TDimensions; ++k)
+            {
+                if (gid[k] < 0 || static_cast<size_type>(gid[k]) >= _sizes[k])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] reference
+    operator()(const Ids& ... ids)
+    {
+        assert(is_valid_ids(ids...));
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] const_reference
+    operator()(const Ids& ... ids) const
+    {
+        assert(is_valid_ids(ids...));
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] reference
+    at_grid(const Ids& ... ids)
+    {
+        if (!is_valid_ids(ids...))
+        {
+            throw std::out_of_range("invalid morton_grid access!");
+        }
+
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] const_reference
+    at_grid(const Ids& ... ids) const
+    {
+        if (!is_valid_ids(ids...))
+        {
+            throw std::out_of_range("invalid morton_grid access!");
+        }
+
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // iterators
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] iterator
+    begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    [[nodiscard]] const_iterator
+    begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    [[nodiscard]] iterator
+    end() noexcept
+    {
+        return iterator(this, static_cast<size_type>(_values.size()));
+    }
+
+    [[nodiscard]] const_iterator
+    end() const noexcept
+    {
+        return const_iterator(this, static_cast<size_type>(_values.size()));
+    }
+
+    //! calls f(value, grid id) for all positions in the box [first, last) with the last dimension running fastest
+    /*!
+     * the list id is advanced via dilated increments, i.e., in O(1) per value
+     */
+    template<typename TFunction>
+    void
+    for_each_in_box(const grid_id_type& first, const grid_id_type& last, TFunction&& f)
+    {
+        _for_each_in_box(*this, first, last, std::forward<TFunction>(f));
+    }
+
+    template<typename TFunction>
+    void
+    for_each_in_box(const grid_id_type& first, const grid_id_type& last, TFunction&& f) const
+    {
+        _for_each_in_box(*this, first, last, std::forward<TFunction>(f));
+    }
+
+  private:
+    template<typename TSelf, typename TFunction>
+    static void
+    _for_each_in_box(TSelf& self, const grid_id_type& first, const grid_id_type& last, TFunction&& f)
+    {
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            assert(first[k] <= last[k] && last[k] <= self._sizes[k] && "invalid box");
+
+            if (first[k] == last[k])
+            {
+                return;
+            }
+        }
+
+        grid_id_type                       gid = first;
+        std::array<size_type, TDimensions> rowStart{};
+        size_type                          lid = self.grid_to_list_id(first);
+
+        rowStart.fill(lid);
+
+        for (;;)
+        {
+            f(self._values[lid], static_cast<const grid_id_type&>(gid));
+
+            size_type k = TDimensions;
+
+            while (k-- > 0)
+            {
+                if (++gid[k] < last[k])
+                {
+                    lid = self._dilated_increment(rowStart[k], k);
+                    rowStart[k] = lid;
+
+                    // positions of the faster dimensions restart at their first index
+                    for (size_type j = k + 1; j < TDimensions; ++j)
+                    {
+                        rowStart[j] = lid;
+                    }
+
+                    break;
+                }
+
+                gid[k] = first[k];
+            }
+
+            if (k == static_cast<size_type>(-1))
+            {
+                break;
+            }
+        }
+    }
+
+    //====================================================================================================
+    //===== SETTER
+    //====================================================================================================
+  public:
+    template<typename T>
+    void
+    resize(std::initializer_list<T> sizes, const value_type& defaultInitValue)
+    {
+        assert(sizes.size() == num_dimensions() && "invalid number or sizes in initializer list");
+        resize(sizes.begin(), sizes.end(), defaultInitValue);
+    }
+
+    //! sets new sizes; all values (incl. padding) are set to defaultInitValue
+    /*!
+     * throws std::length_error if the Morton codes do not fit into 32 bit
+     */
+    template<typename TForwardIterator, std::enable_if_t<!std::is_arithmetic_v<std::decay_t<TForwardIterator>>>* = nullptr>
+    void
+    resize(TForwardIterator first, TForwardIterator last, const value_type& defaultInitValue)
+    {
+        std::copy(first, last, _sizes.begin());
+        assert(std::all_of(_sizes.begin(), _sizes.end(), [](size_type x)
+        {
+            return x > 0;
+        }) && "all sizes must be > 0");
+
+        // number of bits per dimension
+        grid_id_type numBits{};
+        size_type    totalBits = 0;
+        size_type    maxBits   = 0;
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            while (numBits[k] < 32 && (_sizes[k] - 1) >> numBits[k] != 0)
+            {
+                ++numBits[k];
+            }
+
+            totalBits += numBits[k];
+            maxBits = std::max(maxBits, numBits[k]);
+        }
+
+        if (totalBits >= 32)
+        {
+            throw std::length_error("morton_grid: sizes exceed the 32 bit Morton code range");
+        }
+
+        // round robin over the dimensions that still have bits left
+        _masks.fill(0);
+
+        for (size_type level = 0, bit = 0; level < maxBits; ++level)
+        {
+            for (size_type k = 0; k < TDimensions; ++k)
+            {
+                if (level < numBits[k])
+                {
+                    _masks[k] |= 1U << bit++;
+                }
+            }
+        }
+
+        _num_table_bytes = (maxBits + 7) / 8;
+
+#ifndef ND_MORTON_BMI2
+        _tables.assign(TDimensions * std::size_t(_num_table_bytes) * 256U, 0);
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            for (size_type b = 0; b < _num_table_bytes; ++b)
+            {
+                for (size_type x = 0; x < 256U; ++x)
+                {
+                    _tables[(k * _num_table_bytes + b) * 256U + x] = detail::soft_pdep(x << (8 * b), _masks[k]);
+                }
+            }
+        }
+#endif
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            _dilated_max[k] = _dilate(_sizes[k] - 1, k);
+        }
+
+        _values.assign(std::size_t(1) << totalBits, defaultInitValue);
+        _values.shrink_to_fit();
+    }
+
+    void
+    clear()
+    {
+        _sizes.fill(0);
+        _masks.fill(0);
+        _dilated_max.fill(0);
+        _tables.clear();
+        _num_table_bytes = 0;
+        _values.clear();
+    }
+
+    void
+    fill(const_reference value)
+    {
+        std::fill(_values.begin(), _values.end(), value);
+    }
+
+    void
+    swap(self_type& other) noexcept
+    {
+        std::swap(_sizes, other._sizes);
+        std::swap(_masks, other._masks);
+        std::swap(_dilated_max, other._dilated_max);
+        std::swap(_tables, other._tables);
+        std::swap(_num_table_bytes, other._num_table_bytes);
+        std::swap(_values, other._values);
+    }
+}; // class morton_grid
+} // namespace nd
+
+#endif //__ND_MORTON_GRID_H__p5o9i3u7y1t5r9e3w7q1a5s9d3f7g1
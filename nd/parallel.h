@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_PARALLEL_H__q8w2e6r1t9y4u3i7o5p0a2s8d6f1g4
+#define __ND_PARALLEL_H__q8w2e6r1t9y4u3i7o5p0a2s8d6f1g4
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+//====================================================================================================
+//===== minimal thread helpers shared by the containers and importers
+//====================================================================================================
+namespace nd
+{
+namespace detail
+{
+//! numThreads if != 0, otherwise about 1 MB of work per thread up to the hardware concurrency
+[[nodiscard]] inline unsigned int
+num_threads(unsigned int numThreads, std::size_t numBytes)
+{
+    if (numThreads != 0)
+    {
+        return numThreads;
+    }
+
+    // thread start-up dominates below about 1 MB per thread
+    const std::size_t byBytes = numBytes / (std::size_t(1) << 20) + 1;
+
+    return static_cast<unsigned int>(std::min<std::size_t>(std::max(1U, std::thread::hardware_concurrency()), byBytes));
+}
+
+//! calls f(t) for t = 0, ..., numThreads-1 concurrently; f(0) runs on the calling thread
+/*!
+ * the first exception thrown by any f(t) is rethrown after all threads have been joined
+ */
+template<typename TFunction>
+void
+parallel_for(unsigned int numThreads, TFunction&& f)
+{
+    std::vector<std::exception_ptr> errors(numThreads);
+    std::vector<std::thread>        threads;
+    threads.reserve(numThreads);
+
+    const auto run = [&](unsigned int t)
+    {
+        try
+        { f(t); }
+        catch (...)
+        { errors[t] = std::current_exception(); }
+    };
+
+    for (unsigned int t = 1; t < numThreads; ++t)
+    {
+        threads.emplace_back(run, t);
+    }
+
+    run(0);
+
+    for (std::thread& th: threads)
+    {
+        th.join();
+    }
+
+    for (const std::exception_ptr& e: errors)
+    {
+        if (e)
+        {
+            std::rethrow_exception(e);
+        }
+    }
+}
+
+//! calls f(first, last) on numThreads contiguous, nearly equal sub-ranges of [0, n)
+template<typename TFunction>
+void
+parallel_for_range(unsigned int numThreads, std::size_t n, TFunction&& f)
+{
+    numThreads = static_cast<unsigned int>(std::max<std::size_t>(1, std::min<std::size_t>(numThreads, n)));
+
+    parallel_for(numThreads, [&](unsigned int t)
+    {
+        f(n * t / numThreads, n * (t + 1) / numThreads);
+    });
+}
+} // namespace detail
+} // namespace nd
+
+#endif //__ND_PARALLEL_H__q8w2e6r1t9y4u3i7o5p0a2s8d6f1g4
@@ -0,0 +1,427 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_PNM_H__a7c2e9f4b1d8h3j6k0m5n2p8q4r7s1
+#define __ND_PNM_H__a7c2e9f4b1d8h3j6k0m5n2p8q4r7s1
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSSE3__)
+  #include <tmmintrin.h>
+#endif
+
+#include "grid.h"
+
+//====================================================================================================
+//===== binary pgm / ppm (P5 / P6) and pfm (Pf / PF) import and export
+//====================================================================================================
+/*
+ * - grayscale images are nd::grid<T, 2> of size (height, width),
+ *   rgb images are nd::grid<T, 3> of size (height, width, 3); row 0 is the top row
+ * - pgm / ppm: T is std::uint8_t (maxval <= 255) or std::uint16_t (maxval <= 65535, big endian in the file)
+ * - pfm: T is float; rows are stored bottom-to-top in the file
+ * - pixel data are read / written with a single call; byte swapping and row flipping operate on the whole buffer
+ */
+namespace nd
+{
+namespace detail
+{
+[[nodiscard]] inline bool
+pnm_host_is_little_endian() noexcept
+{
+    const std::uint16_t x = 1;
+    unsigned char       c = 0;
+    std::memcpy(&c, &x, 1);
+    return c == 1;
+}
+
+inline void
+pnm_byte_swap(std::uint16_t* p, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(__SSSE3__)
+    const __m128i mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i* q = reinterpret_cast<__m128i*>(p + i);
+        _mm_storeu_si128(q, _mm_shuffle_epi8(_mm_loadu_si128(q), mask));
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        p[i] = static_cast<std::uint16_t>((p[i] >> 8) | (p[i] << 8));
+    }
+}
+
+inline void
+pnm_byte_swap(std::uint32_t* p, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(__SSSE3__)
+    const __m128i mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i* q = reinterpret_cast<__m128i*>(p + i);
+        _mm_storeu_si128(q, _mm_shuffle_epi8(_mm_loadu_si128(q), mask));
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        p[i] = (p[i] >> 24) | ((p[i] >> 8) & 0x0000FF00U) | ((p[i] << 8) & 0x00FF0000U) | (p[i] << 24);
+    }
+}
+
+inline void
+pnm_byte_swap(float* p, std::size_t n) noexcept
+{
+    static_assert(sizeof(float) == sizeof(std::uint32_t));
+    pnm_byte_swap(reinterpret_cast<std::uint32_t*>(p), n);
+}
+
+//! skips whitespace and comments and reads the next token of a header
+[[nodiscard]] inline std::string
+pnm_read_token(std::istream& file, const std::string& path)
+{
+    std::string token;
+
+    for (int c = file.get(); c != EOF; c = file.get())
+    {
+        if (c == '#' && token.empty())
+        {
+            while (c != EOF && c != '\n')
+            { c = file.get(); }
+        }
+        else if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+        {
+            if (!token.empty())
+            {
+                return token; // the single whitespace after the last header token is consumed here
+            }
+        }
+        else
+        {
+            token += static_cast<char>(c);
+        }
+    }
+
+    throw std::runtime_error("pnm: unexpected end of header in \"" + path + "\"");
+}
+
+[[nodiscard]] inline unsigned int
+pnm_read_uint(std::istream& file, const std::string& path)
+{
+    const std::string token = pnm_read_token(file, path);
+
+    try
+    {
+        return static_cast<unsigned int>(std::stoul(token));
+    }
+    catch (const std::exception&)
+    {
+        throw std::runtime_error("pnm: invalid header value \"" + token + "\" in \"" + path + "\"");
+    }
+}
+
+//! reverses the order of rows; a row contains rowLength values
+template<typename T>
+void
+pnm_flip_rows(T* p, std::size_t numRows, std::size_t rowLength)
+{
+    for (std::size_t top = 0; top < numRows / 2; ++top)
+    {
+        const std::size_t bottom = numRows - 1 - top;
+        std::swap_ranges(p + top * rowLength, p + (top + 1) * rowLength, p + bottom * rowLength);
+    }
+}
+
+template<std::size_t TDimensions>
+[[nodiscard]] constexpr unsigned int
+pnm_num_channels() noexcept
+{
+    static_assert(TDimensions == 2 || TDimensions == 3, "images are 2D (grayscale) or 3D (rgb) grids");
+    return TDimensions == 2 ? 1U : 3U;
+}
+
+template<typename T, std::size_t TDimensions>
+[[nodiscard]] grid<T, TDimensions>
+pnm_make_grid(unsigned int width, unsigned int height)
+{
+    if constexpr (TDimensions == 2)
+    {
+        return grid<T, 2>(height, width);
+    }
+    else
+    {
+        return grid<T, 3>(height, width, 3U);
+    }
+}
+
+template<typename T, std::size_t TDimensions>
+void
+pnm_check_channels(const grid<T, TDimensions>& img, const char* function)
+{
+    if constexpr (TDimensions == 3)
+    {
+        if (!img.empty() && img.size(2) != 3)
+        {
+            throw std::invalid_argument(std::string(function) + ": rgb images must have size 3 in dimension 2");
+        }
+    }
+}
+} // namespace detail
+
+//------------------------------------------------------------------------------------------------------
+// pgm / ppm
+//------------------------------------------------------------------------------------------------------
+//! reads a binary pgm (TDimensions == 2) or ppm (TDimensions == 3)
+/*!
+ * 8 bit files can be read as std::uint8_t or std::uint16_t, 16 bit files as std::uint16_t.
+ * Throws std::runtime_error if the file cannot be read or does not match.
+ */
+template<typename T, std::size_t TDimensions>
+[[nodiscard]] grid<T, TDimensions>
+read_pnm(const std::string& path)
+{
+    static_assert(std::is_same_v<T, std::uint8_t> || std::is_same_v<T, std::uint16_t>, "pgm / ppm images are read as std::uint8_t or std::uint16_t");
+
+    constexpr unsigned int numChannels = detail::pnm_num_channels<TDimensions>();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.good())
+    {
+        throw std::runtime_error("read_pnm: cannot open file \"" + path + "\"");
+    }
+
+    const std::string magic = detail::pnm_read_token(file, path);
+    if (magic != (numChannels == 1 ? "P5" : "P6"))
+    {
+        throw std::runtime_error("read_pnm: expected a binary " + std::string(numChannels == 1 ? "pgm (P5)" : "ppm (P6)") + " file but found \"" + magic + "\" in \"" + path + "\"");
+    }
+
+    const unsigned int width  = detail::pnm_read_uint(file, path);
+    const unsigned int height = detail::pnm_read_uint(file, path);
+    const unsigned int maxval = detail::pnm_read_uint(file, path);
+
+    if (width == 0 || height == 0 || maxval == 0 || maxval > 65535)
+    {
+        throw std::runtime_error("read_pnm: invalid header in \"" + path + "\"");
+    }
+
+    const bool is16Bit = maxval > 255;
+    if (is16Bit && sizeof(T) == 1)
+    {
+        throw std::runtime_error("read_pnm: \"" + path + "\" is a 16 bit image; read it as std::uint16_t");
+    }
+
+    grid<T, TDimensions> img = detail::pnm_make_grid<T, TDimensions>(width, height);
+    T* const             p   = img.data().data();
+    const std::size_t    n   = img.num_values();
+
+    if (is16Bit || sizeof(T) == 1)
+    {
+        file.read(reinterpret_cast<char*>(p), static_cast<std::streamsize>(n * sizeof(T)));
+
+        if constexpr (sizeof(T) == 2)
+        {
+            if (detail::pnm_host_is_little_endian())
+            {
+                detail::pnm_byte_swap(p, n);
+            }
+        }
+    }
+    else
+    {
+        // 8 bit file into 16 bit grid
+        std::vector<std::uint8_t> buf(n);
+        file.read(reinterpret_cast<char*>(buf.data()), static_cast<std::streamsize>(n));
+        std::copy(buf.begin(), buf.end(), p);
+    }
+
+    if (!file.good())
+    {
+        throw std::runtime_error("read_pnm: unexpected end of pixel data in \"" + path + "\"");
+    }
+
+    return img;
+}
+
+//! writes a binary pgm (2D grid) or ppm (3D grid with size 3 in dimension 2)
+/*!
+ * maxval is 255 for std::uint8_t and 65535 for std::uint16_t.
+ * Throws std::runtime_error if the file cannot be written.
+ */
+template<typename T, std::size_t TDimensions>
+void
+write_pnm(const std::string& path, const grid<T, TDimensions>& img)
+{
+    static_assert(std::is_same_v<T, std::uint8_t> || std::is_same_v<T, std::uint16_t>, "pgm / ppm images are written from std::uint8_t or std::uint16_t");
+
+    constexpr unsigned int numChannels = detail::pnm_num_channels<TDimensions>();
+    detail::pnm_check_channels(img, "write_pnm");
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.good())
+    {
+        throw std::runtime_error("write_pnm: cannot open file \"" + path + "\"");
+    }
+
+    const std::string header = std::string(numChannels == 1 ? "P5" : "P6") + "\n"
+                               + std::to_string(img.size(1)) + " " + std::to_string(img.size(0)) + "\n"
+                               + (sizeof(T) == 1 ? "255" : "65535") + "\n";
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+    const std::size_t n = img.num_values();
+
+    if constexpr (sizeof(T) == 2)
+    {
+        if (detail::pnm_host_is_little_endian())
+        {
+            std::vector<T> buf(img.begin(), img.end());
+            detail::pnm_byte_swap(buf.data(), n);
+            file.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(n * sizeof(T)));
+        }
+        else
+        {
+            file.write(reinterpret_cast<const char*>(img.data().data()), static_cast<std::streamsize>(n * sizeof(T)));
+        }
+    }
+    else
+    {
+        file.write(reinterpret_cast<const char*>(img.data().data()), static_cast<std::streamsize>(n * sizeof(T)));
+    }
+
+    if (!file.good())
+    {
+        throw std::runtime_error("write_pnm: cannot write file \"" + path + "\"");
+    }
+}
+
+//------------------------------------------------------------------------------------------------------
+// pfm
+//------------------------------------------------------------------------------------------------------
+//! reads a grayscale (Pf, TDimensions == 2) or rgb (PF, TDimensions == 3) pfm
+/*!
+ * Throws std::runtime_error if the file cannot be read or does not match.
+ */
+template<std::size_t TDimensions>
+[[nodiscard]] grid<float, TDimensions>
+read_pfm(const std::string& path)
+{
+    constexpr unsigned int numChannels = detail::pnm_num_channels<TDimensions>();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.good())
+    {
+        throw std::runtime_error("read_pfm: cannot open file \"" + path + "\"");
+    }
+
+    const std::string magic = detail::pnm_read_token(file, path);
+    if (magic != (numChannels == 1 ? "Pf" : "PF"))
+    {
+        throw std::runtime_error("read_pfm: expected a " + std::string(numChannels == 1 ? "grayscale (Pf)" : "rgb (PF)") + " file but found \"" + magic + "\" in \"" + path + "\"");
+    }
+
+    const unsigned int width  = detail::pnm_read_uint(file, path);
+    const unsigned int height = detail::pnm_read_uint(file, path);
+    const std::string  scale  = detail::pnm_read_token(file, path);
+
+    if (width == 0 || height == 0 || scale.empty())
+    {
+        throw std::runtime_error("read_pfm: invalid header in \"" + path + "\"");
+    }
+
+    // a negative scale denotes little endian data
+    const bool fileIsLittleEndian = scale[0] == '-';
+
+    grid<float, TDimensions> img = detail::pnm_make_grid<float, TDimensions>(width, height);
+    float* const             p   = img.data().data();
+    const std::size_t        n   = img.num_values();
+
+    file.read(reinterpret_cast<char*>(p), static_cast<std::streamsize>(n * sizeof(float)));
+
+    if (!file.good())
+    {
+        throw std::runtime_error("read_pfm: unexpected end of pixel data in \"" + path + "\"");
+    }
+
+    if (fileIsLittleEndian != detail::pnm_host_is_little_endian())
+    {
+        detail::pnm_byte_swap(p, n);
+    }
+
+    detail::pnm_flip_rows(p, height, static_cast<std::size_t>(width) * numChannels);
+
+    return img;
+}
+
+//! writes a grayscale (2D grid) or rgb (3D grid with size 3 in dimension 2) pfm in host byte order
+/*!
+ * Throws std::runtime_error if the file cannot be written.
+ */
+template<std::size_t TDimensions>
+void
+write_pfm(const std::string& path, const grid<float, TDimensions>& img)
+{
+    constexpr unsigned int numChannels = detail::pnm_num_channels<TDimensions>();
+    detail::pnm_check_channels(img, "write_pfm");
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.good())
+    {
+        throw std::runtime_error("write_pfm: cannot open file \"" + path + "\"");
+    }
+
+    const unsigned int height = img.size(0);
+    const unsigned int width  = img.size(1);
+
+    const std::string header = std::string(numChannels == 1 ? "Pf" : "PF") + "\n"
+                               + std::to_string(width) + " " + std::to_string(height) + "\n"
+                               + (detail::pnm_host_is_little_endian() ? "-1.0" : "1.0") + "\n";
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+    std::vector<float> buf(img.begin(), img.end());
+    detail::pnm_flip_rows(buf.data(), height, static_cast<std::size_t>(width) * numChannels);
+    file.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size() * sizeof(float)));
+
+    if (!file.good())
+    {
+        throw std::runtime_error("write_pfm: cannot write file \"" + path + "\"");
+    }
+}
+} // namespace nd
+
+#endif //__ND_PNM_H__a7c2e9f4b1d8h3j6k0m5n2p8q4r7s1
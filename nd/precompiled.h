@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#ifndef __ND_PRECOMPILED_H__q7w1e5r9t3y7u1i5o9p3a7s1d5f9g3
+#define __ND_PRECOMPILED_H__q7w1e5r9t3y7u1i5o9p3a7s1d5f9g3
+
+//====================================================================================================
+//===== precompiled instantiations
+//====================================================================================================
+/*
+ * value types and ranks of nd::grid / nd::vector that are compiled once into the
+ * ndcontainer_precompiled library (target bk::ndcontainer_precompiled):
+ *
+ *     target_link_libraries(my_target PRIVATE bk::ndcontainer_precompiled)
+ *
+ * linking it defines ND_PRECOMPILED, which makes grid.h and vector.h declare the listed
+ * instantiations as extern templates, so including translation units no longer instantiate
+ * the non-inline members themselves; other value types / ranks are instantiated as usual
+ *
+ * only value types that support every member (incl. from_string()) can be listed, i.e. no char types
+ */
+
+#define ND_PRECOMPILED_FOR_EACH_VALUE_TYPE(MACRO, EXTERN) \
+    MACRO(EXTERN, float)                                  \
+    MACRO(EXTERN, double)                                 \
+    MACRO(EXTERN, int)                                    \
+    MACRO(EXTERN, unsigned int)                           \
+    MACRO(EXTERN, unsigned short)
+
+#define ND_PRECOMPILED_GRID(EXTERN, T)                                      \
+    EXTERN template class nd::grid<T, 1, nd::layout::last_axis_contiguous>; \
+    EXTERN template class nd::grid<T, 2, nd::layout::last_axis_contiguous>; \
+    EXTERN template class nd::grid<T, 3, nd::layout::last_axis_contiguous>; \
+    EXTERN template class nd::grid<T, 4, nd::layout::last_axis_contiguous>;
+
+#define ND_PRECOMPILED_VECTOR(EXTERN, T) \
+    EXTERN template class nd::vector<T, nd::layout::last_axis_contiguous>;
+
+#define ND_PRECOMPILED_GRID_INSTANTIATIONS(EXTERN)   ND_PRECOMPILED_FOR_EACH_VALUE_TYPE(ND_PRECOMPILED_GRID, EXTERN)
+#define ND_PRECOMPILED_VECTOR_INSTANTIATIONS(EXTERN) ND_PRECOMPILED_FOR_EACH_VALUE_TYPE(ND_PRECOMPILED_VECTOR, EXTERN)
+
+#endif //__ND_PRECOMPILED_H__q7w1e5r9t3y7u1i5o9p3a7s1d5f9g3
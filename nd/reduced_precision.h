@@ -0,0 +1,690 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_REDUCED_PRECISION_H__b6n0m4q8w2e6r0t4y8u2i6o0p4a8
+#define __ND_REDUCED_PRECISION_H__b6n0m4q8w2e6r0t4y8u2i6o0p4a8
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__F16C__) && defined(__AVX__)
+  #include <immintrin.h>
+  #define ND_F16C
+#endif
+
+#include "convert.h"
+#include "grid.h"
+#include "parallel.h"
+
+//====================================================================================================
+//===== reduced-precision and quantized storage
+//====================================================================================================
+/*
+ * value types that halve the memory traffic of float grids:
+ *
+ *     const nd::grid<nd::half, 3> h = volume;          // nd::grid< float, 3 > -> IEEE binary16 (F16C if available)
+ *     const nd::grid<float, 3> f = h.cast<float>();
+ *     const double s = nd::sum(h);                     // decodes blockwise on the fly, no float copy
+ *     const float v = nd::sample_linear(h, std::array<float, 3>{1.5F, 2.25F, 7.0F});
+ *
+ *     const nd::quantized_grid<std::uint8_t, 3> q(volume); // 8 bit codes, value = offset + scale * code
+ *     const double m = q.mean();                            // reductions run on the integer codes
+ *
+ * - half and bfloat16 convert implicitly from / to float, so they work as value types of nd::grid and nd::vector;
+ *   bulk conversions through the converting constructors, assignments and cast() use nd::detail::value_converter
+ * - float <-> bfloat16 and the software float <-> half conversion are branch-free loops that the compiler vectorizes
+ * - quantization parameters belong to a whole grid; quantized_grid keeps them next to an nd::grid of codes
+ */
+namespace nd
+{
+namespace detail
+{
+[[nodiscard]] inline std::uint32_t
+float_bits(float x) noexcept
+{
+    std::uint32_t u;
+    std::memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+[[nodiscard]] inline float
+bits_float(std::uint32_t u) noexcept
+{
+    float x;
+    std::memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+//! IEEE binary32 -> binary16 with round to nearest even; NaN stays (quiet) NaN
+[[nodiscard]] inline std::uint16_t
+float_to_half_bits(float x) noexcept
+{
+    constexpr std::uint32_t f32Infinity = 255U << 23;
+    constexpr std::uint32_t f16Max      = (127U + 16U) << 23;
+    const float             denormMagic = bits_float(((127U - 15U) + (23U - 10U) + 1U) << 23);
+
+    std::uint32_t       f    = float_bits(x);
+    const std::uint32_t sign = f & 0x80000000U;
+    std::uint32_t       h;
+
+    f ^= sign;
+
+    if (f >= f16Max)
+    {
+        h = f > f32Infinity ? 0x7E00U : 0x7C00U;
+    }
+    else if (f < (113U << 23))
+    {
+        // subnormal or zero: let the FPU do the rounding
+        h = float_bits(bits_float(f) + denormMagic) - float_bits(denormMagic);
+    }
+    else
+    {
+        const std::uint32_t mantissaOdd = (f >> 13) & 1U;
+        f += (static_cast<std::uint32_t>(15 - 127) << 23) + 0xFFFU + mantissaOdd;
+        h = f >> 13;
+    }
+
+    return static_cast<std::uint16_t>(h | (sign >> 16));
+}
+
+//! IEEE binary16 -> binary32 (exact)
+[[nodiscard]] inline float
+half_bits_to_float(std::uint16_t h) noexcept
+{
+    constexpr std::uint32_t shiftedExponent = 0x7C00U << 13;
+
+    std::uint32_t       f        = (static_cast<std::uint32_t>(h) & 0x7FFFU) << 13;
+    const std::uint32_t exponent = f & shiftedExponent;
+
+    f += (127U - 15U) << 23;
+
+    if (exponent == shiftedExponent)
+    {
+        f += (128U - 16U) << 23; // Inf / NaN
+    }
+    else if (exponent == 0)
+    {
+        f += 1U << 23; // zero / subnormal: renormalize
+        f = float_bits(bits_float(f) - bits_float(113U << 23));
+    }
+
+    return bits_float(f | ((static_cast<std::uint32_t>(h) & 0x8000U) << 16));
+}
+
+//! IEEE binary32 -> bfloat16 with round to nearest even; NaN stays NaN
+[[nodiscard]] inline std::uint16_t
+float_to_bfloat16_bits(float x) noexcept
+{
+    const std::uint32_t f       = float_bits(x);
+    const std::uint32_t rounded = (f + 0x7FFFU + ((f >> 16) & 1U)) >> 16;
+    const bool          isNan   = (f & 0x7FFFFFFFU) > 0x7F800000U;
+
+    return static_cast<std::uint16_t>(isNan ? (f >> 16) | 0x40U : rounded);
+}
+
+[[nodiscard]] inline float
+bfloat16_bits_to_float(std::uint16_t b) noexcept
+{
+    return bits_float(static_cast<std::uint32_t>(b) << 16);
+}
+} // namespace detail
+
+//------------------------------------------------------------------------------------------------------
+// half / bfloat16
+//------------------------------------------------------------------------------------------------------
+//! IEEE 754 binary16 storage type; arithmetic is done in float
+class half
+{
+    std::uint16_t _bits = 0;
+
+  public:
+    half() = default;
+
+    template<typename U, std::enable_if_t<std::is_arithmetic_v<U>>* = nullptr>
+    half(U x) noexcept :
+        _bits(detail::float_to_half_bits(static_cast<float>(x)))
+    {
+    }
+
+    [[nodiscard]] operator float() const noexcept
+    {
+        return detail::half_bits_to_float(_bits);
+    }
+
+    [[nodiscard]] static half
+    from_bits(std::uint16_t bits) noexcept
+    {
+        half h;
+        h._bits = bits;
+        return h;
+    }
+
+    [[nodiscard]] std::uint16_t
+    bits() const noexcept
+    {
+        return _bits;
+    }
+};
+
+//! upper 16 bits of an IEEE 754 binary32 (8 exponent bits, 7 mantissa bits); arithmetic is done in float
+class bfloat16
+{
+    std::uint16_t _bits = 0;
+
+  public:
+    bfloat16() = default;
+
+    template<typename U, std::enable_if_t<std::is_arithmetic_v<U>>* = nullptr>
+    bfloat16(U x) noexcept :
+        _bits(detail::float_to_bfloat16_bits(static_cast<float>(x)))
+    {
+    }
+
+    [[nodiscard]] operator float() const noexcept
+    {
+        return detail::bfloat16_bits_to_float(_bits);
+    }
+
+    [[nodiscard]] static bfloat16
+    from_bits(std::uint16_t bits) noexcept
+    {
+        bfloat16 b;
+        b._bits = bits;
+        return b;
+    }
+
+    [[nodiscard]] std::uint16_t
+    bits() const noexcept
+    {
+        return _bits;
+    }
+};
+
+static_assert(sizeof(half) == 2 && std::is_trivially_copyable_v<half>);
+static_assert(sizeof(bfloat16) == 2 && std::is_trivially_copyable_v<bfloat16>);
+
+//------------------------------------------------------------------------------------------------------
+// bulk conversion
+//------------------------------------------------------------------------------------------------------
+namespace detail
+{
+template<>
+struct value_converter<float, half>
+{
+    static void
+    convert(const float* src, std::size_t n, half* dst) noexcept
+    {
+        std::size_t i = 0;
+
+#ifdef ND_F16C
+        for (; i + 8 <= n; i += 8)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+        }
+#endif
+
+        for (; i < n; ++i)
+        {
+            dst[i] = half::from_bits(float_to_half_bits(src[i]));
+        }
+    }
+};
+
+template<>
+struct value_converter<half, float>
+{
+    static void
+    convert(const half* src, std::size_t n, float* dst) noexcept
+    {
+        std::size_t i = 0;
+
+#ifdef ND_F16C
+        for (; i + 8 <= n; i += 8)
+        {
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+        }
+#endif
+
+        for (; i < n; ++i)
+        {
+            dst[i] = half_bits_to_float(src[i].bits());
+        }
+    }
+};
+
+template<>
+struct value_converter<float, bfloat16>
+{
+    static void
+    convert(const float* src, std::size_t n, bfloat16* dst) noexcept
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            dst[i] = bfloat16::from_bits(float_to_bfloat16_bits(src[i]));
+        }
+    }
+};
+
+template<>
+struct value_converter<bfloat16, float>
+{
+    static void
+    convert(const bfloat16* src, std::size_t n, float* dst) noexcept
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            dst[i] = bfloat16_bits_to_float(src[i].bits());
+        }
+    }
+};
+
+//! value types that decode to float without loss
+template<typename T>
+inline constexpr bool is_float_storage_v = std::is_same_v<T, float> || std::is_same_v<T, half> || std::is_same_v<T, bfloat16>;
+
+//! calls f(const float* block, n) for consecutive blocks of values decoded to float
+template<typename T, typename TFunction>
+void
+for_each_float_block(const T* values, std::size_t n, TFunction&& f)
+{
+    static_assert(is_float_storage_v<T>, "only float, half and bfloat16 values can be decoded to float without loss");
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        f(values, n);
+    }
+    else
+    {
+        constexpr std::size_t blockSize = 512;
+        float                 block[blockSize];
+
+        for (std::size_t i = 0; i < n; i += blockSize)
+        {
+            const std::size_t m = std::min(blockSize, n - i);
+            value_converter<T, float>::convert(values + i, m, block);
+            f(static_cast<const float*>(block), m);
+        }
+    }
+}
+} // namespace detail
+
+//------------------------------------------------------------------------------------------------------
+// reductions / sampling with on-the-fly decoding
+//------------------------------------------------------------------------------------------------------
+//! sum of all values of an nd::grid / nd::vector of float, half or bfloat16 as double; reduced-precision values are decoded blockwise
+/*!
+ * sum / mean / min_max only take part in overload resolution for float, half and bfloat16 values,
+ * so an unqualified sum(c) of a user's own container still finds the user's function
+ */
+template<typename TContainer, std::enable_if_t<detail::is_float_storage_v<typename TContainer::value_type>>* = nullptr>
+[[nodiscard]] double
+sum(const TContainer& c)
+{
+    double s = 0;
+
+    detail::for_each_float_block(c.data().data(), c.data().size(), [&](const float* block, std::size_t n)
+    {
+        double blockSum = 0;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            blockSum += block[i];
+        }
+
+        s += blockSum;
+    });
+
+    return s;
+}
+
+template<typename TContainer, std::enable_if_t<detail::is_float_storage_v<typename TContainer::value_type>>* = nullptr>
+[[nodiscard]] double
+mean(const TContainer& c)
+{
+    return c.data().empty() ? 0.0 : nd::sum(c) / static_cast<double>(c.data().size());
+}
+
+//! (min, max) of all values of an nd::grid / nd::vector of float, half or bfloat16; NaNs are ignored. (+inf, -inf) if there are no values
+template<typename TContainer, std::enable_if_t<detail::is_float_storage_v<typename TContainer::value_type>>* = nullptr>
+[[nodiscard]] std::pair<float, float>
+min_max(const TContainer& c)
+{
+    float lo = std::numeric_limits<float>::infinity();
+    float hi = -lo;
+
+    detail::for_each_float_block(c.data().data(), c.data().size(), [&](const float* block, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            lo = block[i] < lo ? block[i] : lo;
+            hi = block[i] > hi ? block[i] : hi;
+        }
+    });
+
+    return {lo, hi};
+}
+
+//! multilinear interpolation at a continuous position (one coordinate per dimension); positions are clamped to the grid
+/*!
+ * only the 2^N neighbouring values are decoded
+ */
+template<typename TContainer, typename TPosition>
+[[nodiscard]] float
+sample_linear(const TContainer& c, const TPosition& pos)
+{
+    const std::size_t numDims = std::size(pos);
+    assert(numDims == c.size().size() && numDims <= 16 && "invalid number of coordinates");
+
+    std::size_t                 base = 0;
+    std::array<std::size_t, 16> steps{};
+    std::array<float, 16>       weights{};
+
+    for (std::size_t k = 0; k < numDims; ++k)
+    {
+        const auto  size = static_cast<float>(c.size(static_cast<unsigned int>(k)));
+        const float p    = std::clamp(static_cast<float>(pos[k]), 0.0F, size - 1);
+        const auto  i    = std::min(static_cast<std::size_t>(p), static_cast<std::size_t>(size) - 1);
+
+        base += i * c.stride(static_cast<unsigned int>(k));
+        steps[k]   = i + 1 < static_cast<std::size_t>(size) ? c.stride(static_cast<unsigned int>(k)) : 0;
+        weights[k] = p - static_cast<float>(i);
+    }
+
+    const auto* values = c.data().data();
+    float       result = 0;
+
+    for (std::size_t corner = 0; corner < (std::size_t(1) << numDims); ++corner)
+    {
+        std::size_t lid = base;
+        float       w   = 1;
+
+        for (std::size_t k = 0; k < numDims; ++k)
+        {
+            if ((corner >> k) & 1U)
+            {
+                lid += steps[k];
+                w *= weights[k];
+            }
+            else
+            {
+                w *= 1 - weights[k];
+            }
+        }
+
+        if (w != 0)
+        {
+            result += w * static_cast<float>(values[lid]);
+        }
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------------------------------
+// quantization
+//------------------------------------------------------------------------------------------------------
+//! affine mapping between unsigned integer codes and float: value = offset + scale * code
+template<typename TCode>
+struct quantization
+{
+    static_assert(std::is_integral_v<TCode> && std::is_unsigned_v<TCode> && sizeof(TCode) <= 2, "codes must be 8 or 16 bit unsigned integers");
+
+    static constexpr TCode max_code = std::numeric_limits<TCode>::max();
+
+    float scale  = 1.0F;
+    float offset = 0.0F;
+
+    //! maps [lo, hi] to [0, max_code]
+    [[nodiscard]] static quantization
+    from_range(float lo, float hi) noexcept
+    {
+        quantization q;
+        q.offset = lo;
+        q.scale  = hi > lo ? (hi - lo) / static_cast<float>(max_code) : 1.0F;
+        return q;
+    }
+
+    //! nearest code; values outside the range are clamped
+    [[nodiscard]] TCode
+    encode(float x) const noexcept
+    {
+        const float c = std::clamp((x - offset) / scale + 0.5F, 0.0F, static_cast<float>(max_code));
+        return static_cast<TCode>(c);
+    }
+
+    [[nodiscard]] float
+    decode(TCode c) const noexcept
+    {
+        return offset + scale * static_cast<float>(c);
+    }
+};
+
+//! grid of 8 or 16 bit codes with one quantization for all values
+template<typename TCode, std::size_t TDimensions>
+class quantized_grid
+{
+  public:
+    using self_type = quantized_grid<TCode, TDimensions>;
+    using code_type = TCode;
+    using value_type = float;
+    using size_type = typename grid<TCode, TDimensions>::size_type;
+    using quantization_type = quantization<TCode>;
+
+  private:
+    grid<TCode, TDimensions> _codes;
+    quantization_type        _quantization;
+
+  public:
+    quantized_grid() = default;
+
+    //! quantizes to the value range of g
+    /*!
+     * numThreads == 0 picks the number of threads from the hardware and the grid size.
+     */
+    explicit quantized_grid(const grid<float, TDimensions>& g, unsigned int numThreads = 0) :
+        quantized_grid(g, _range_of(g), numThreads)
+    {
+    }
+
+    quantized_grid(const grid<float, TDimensions>& g, const quantization_type& q, unsigned int numThreads = 0) :
+        _quantization(q)
+    {
+        if (g.empty())
+        {
+            return;
+        }
+
+        _codes.resize(g.size().begin(), g.size().end(), TCode(0));
+
+        const float* __restrict src      = g.data().data();
+        TCode* __restrict       dst      = _codes.data().data();
+        const float             invScale = 1.0F / q.scale;
+        const float             maxCode  = static_cast<float>(quantization_type::max_code);
+
+        numThreads = detail::num_threads(numThreads, g.num_values() * sizeof(float));
+
+        detail::parallel_for_range(numThreads, g.num_values(), [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                dst[i] = static_cast<TCode>(std::clamp((src[i] - q.offset) * invScale + 0.5F, 0.0F, maxCode));
+            }
+        });
+    }
+
+  private:
+    [[nodiscard]] static quantization_type
+    _range_of(const grid<float, TDimensions>& g)
+    {
+        const auto [lo, hi] = nd::min_max(g);
+        return g.empty() ? quantization_type() : quantization_type::from_range(lo, hi);
+    }
+
+  public:
+    //------------------------------------------------------------------------------------------------------
+    // getter
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] const grid<TCode, TDimensions>&
+    codes() const noexcept
+    {
+        return _codes;
+    }
+
+    [[nodiscard]] grid<TCode, TDimensions>&
+    codes() noexcept
+    {
+        return _codes;
+    }
+
+    [[nodiscard]] const quantization_type&
+    parameters() const noexcept
+    {
+        return _quantization;
+    }
+
+    [[nodiscard]] const std::array<size_type, TDimensions>&
+    size() const noexcept
+    {
+        return _codes.size();
+    }
+
+    [[nodiscard]] size_type
+    size(size_type dimId) const
+    {
+        return _codes.size(dimId);
+    }
+
+    [[nodiscard]] size_type
+    num_values() const noexcept
+    {
+        return _codes.num_values();
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return _codes.empty();
+    }
+
+    //! decoded value
+    template<typename... Ids>
+    [[nodiscard]] float
+    operator()(const Ids& ... ids) const
+    {
+        return _quantization.decode(_codes(ids...));
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // decoding
+    //------------------------------------------------------------------------------------------------------
+    template<typename T = float>
+    [[nodiscard]] grid<T, TDimensions>
+    cast(unsigned int numThreads = 0) const
+    {
+        grid<T, TDimensions> g;
+
+        if (empty())
+        {
+            return g;
+        }
+
+        g.resize(size().begin(), size().end(), T(0));
+
+        const TCode* __restrict src    = _codes.data().data();
+        T* __restrict           dst    = g.data().data();
+        const float             scale  = _quantization.scale;
+        const float             offset = _quantization.offset;
+
+        numThreads = detail::num_threads(numThreads, num_values() * sizeof(T));
+
+        detail::parallel_for_range(numThreads, num_values(), [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                dst[i] = static_cast<T>(offset + scale * static_cast<float>(src[i]));
+            }
+        });
+
+        return g;
+    }
+
+    //! sum of the decoded values, computed from the exact integer sum of the codes
+    [[nodiscard]] double
+    sum() const noexcept
+    {
+        std::uint64_t codeSum = 0;
+
+        for (const TCode c: _codes.data())
+        {
+            codeSum += c;
+        }
+
+        return static_cast<double>(_quantization.offset) * num_values() + static_cast<double>(_quantization.scale) * static_cast<double>(codeSum);
+    }
+
+    [[nodiscard]] double
+    mean() const noexcept
+    {
+        return empty() ? 0.0 : sum() / num_values();
+    }
+
+    [[nodiscard]] std::pair<float, float>
+    min_max() const noexcept
+    {
+        if (empty())
+        {
+            return {std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+        }
+
+        const auto [lo, hi] = std::minmax_element(_codes.data().begin(), _codes.data().end());
+        const float a = _quantization.decode(*lo);
+        const float b = _quantization.decode(*hi);
+
+        return {std::min(a, b), std::max(a, b)};
+    }
+
+    //! multilinear interpolation of the codes, decoded once (decoding is affine)
+    template<typename TPosition>
+    [[nodiscard]] float
+    sample_linear(const TPosition& pos) const
+    {
+        return _quantization.offset + _quantization.scale * nd::sample_linear(_codes, pos);
+    }
+}; // class quantized_grid
+} // namespace nd
+
+#endif //__ND_REDUCED_PRECISION_H__b6n0m4q8w2e6r0t4y8u2i6o0p4a8
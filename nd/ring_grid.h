@@ -0,0 +1,531 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_RING_GRID_H__h8g2f6d0s4a8p2o6i0u4y8t2r6e0w4
+#define __ND_RING_GRID_H__h8g2f6d0s4a8p2o6i0u4y8t2r6e0w4
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "grid.h"
+
+//====================================================================================================
+//===== class ring_grid
+//====================================================================================================
+/*
+ * N-dimensional ring buffer of (N-1)-dimensional frames; dimension 0 (time) is circular:
+ *
+ *     nd::ring_grid<float, 3> last(8, h, w); // keeps the last 8 frames of size h x w
+ *     last.push_back(frame);                 // frame: nd::grid< float, 2 >; overwrites the oldest frame if full
+ *     const float v = last(0, y, x);         // time 0 is the oldest, num_frames() - 1 the newest frame
+ *
+ *     for (const auto& s: last.spans())      // oldest to newest: at most two contiguous ranges of whole frames
+ *         for (std::size_t i = 0; i < s.size(); ++i) ...
+ *
+ * - push_back() copies one frame (O(frame size)); logical times map to storage slots through a rotating offset
+ * - frames are contiguous, so per-voxel temporal filters run as vectorizable loops over frames and voxels
+ */
+namespace nd
+{
+template<typename T, std::size_t TDimensions>
+class ring_grid
+{
+    //------------------------------------------------------------------------------------------------------
+    // assertions
+    //------------------------------------------------------------------------------------------------------
+    static_assert(TDimensions > 1, "ring_grid needs a time dimension and at least one frame dimension");
+
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] static constexpr std::size_t
+    num_dimensions() noexcept
+    {
+        return TDimensions;
+    }
+
+    using self_type = ring_grid<T, TDimensions>;
+    using value_type = T;
+    using data_container_type = std::vector<T>;
+    using size_type = unsigned int;
+    using difference_type = int;
+    using reference = typename data_container_type::reference;
+    using const_reference = typename data_container_type::const_reference;
+    using frame_type = grid<T, TDimensions - 1>;
+
+    //! contiguous range of values
+    template<typename V>
+    class basic_span
+    {
+        V*          _data = nullptr;
+        std::size_t _size = 0;
+
+      public:
+        constexpr basic_span() noexcept = default;
+
+        constexpr basic_span(V* data, std::size_t size) noexcept :
+            _data(data)
+            , _size(size)
+        {
+        }
+
+        [[nodiscard]] constexpr V*
+        data() const noexcept
+        {
+            return _data;
+        }
+
+        [[nodiscard]] constexpr std::size_t
+        size() const noexcept
+        {
+            return _size;
+        }
+
+        [[nodiscard]] constexpr bool
+        empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+        [[nodiscard]] constexpr V&
+        operator[](std::size_t i) const noexcept
+        {
+            return _data[i];
+        }
+
+        [[nodiscard]] constexpr V*
+        begin() const noexcept
+        {
+            return _data;
+        }
+
+        [[nodiscard]] constexpr V*
+        end() const noexcept
+        {
+            return _data + _size;
+        }
+    };
+
+    using span = basic_span<T>;
+    using const_span = basic_span<const T>;
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    //! _sizes[0] is the capacity in frames
+    std::array<size_type, TDimensions> _sizes{};
+    std::array<size_type, TDimensions> _strides{};
+    //! storage slot of the oldest frame
+    size_type                          _head       = 0;
+    size_type                          _num_frames = 0;
+    data_container_type                _values;
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    ring_grid() = default;
+
+    ring_grid(const self_type&) = default;
+
+    ring_grid(self_type&&) noexcept = default;
+
+    //! capacity (number of frames) followed by the frame sizes; the ring is empty
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) == TDimensions && std::conjunction_v<std::is_integral<std::decay_t<TSizes>>...>>* = nullptr>
+    explicit ring_grid(TSizes... sizes)
+    {
+        resize({static_cast<size_type>(sizes)...});
+    }
+
+    template<typename TIndex>
+    ring_grid(std::initializer_list<TIndex> sizes)
+    {
+        resize(sizes);
+    }
+
+    ~ring_grid() = default;
+
+    self_type&
+    operator=(const self_type&) = default;
+
+    self_type&
+    operator=(self_type&&) noexcept = default;
+
+    //------------------------------------------------------------------------------------------------------
+    // sizes
+    //------------------------------------------------------------------------------------------------------
+    //! maximum number of frames
+    [[nodiscard]] size_type
+    capacity() const noexcept
+    {
+        return _sizes[0];
+    }
+
+    [[nodiscard]] size_type
+    num_frames() const noexcept
+    {
+        return _num_frames;
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return _num_frames == 0;
+    }
+
+    [[nodiscard]] bool
+    full() const noexcept
+    {
+        return _num_frames == capacity() && !_values.empty();
+    }
+
+    //! logical sizes; size()[0] is num_frames()
+    [[nodiscard]] std::array<size_type, TDimensions>
+    size() const noexcept
+    {
+        std::array<size_type, TDimensions> s = _sizes;
+        s[0] = _num_frames;
+        return s;
+    }
+
+    [[nodiscard]] size_type
+    size(size_type dimId) const
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return dimId == 0 ? _num_frames : _sizes[dimId];
+    }
+
+    //! strides within the storage; stride(0) is the number of values per frame
+    [[nodiscard]] const std::array<size_type, TDimensions>&
+    strides() const noexcept
+    {
+        return _strides;
+    }
+
+    [[nodiscard]] size_type
+    stride(size_type dimId) const
+    {
+        return _strides[dimId];
+    }
+
+    [[nodiscard]] size_type
+    frame_num_values() const noexcept
+    {
+        return _strides[0];
+    }
+
+    [[nodiscard]] size_type
+    num_values() const noexcept
+    {
+        return _num_frames * _strides[0];
+    }
+
+    //! all slots in storage order; use spans() for the chronological order
+    [[nodiscard]] data_container_type&
+    data() noexcept
+    {
+        return _values;
+    }
+
+    [[nodiscard]] const data_container_type&
+    data() const noexcept
+    {
+        return _values;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // frames
+    //------------------------------------------------------------------------------------------------------
+  private:
+    [[nodiscard]] size_type
+    _slot(size_type t) const noexcept
+    {
+        assert(t < _num_frames && "time out of bounds");
+
+        const size_type slot = _head + t;
+        return slot >= capacity() ? slot - capacity() : slot;
+    }
+
+  public:
+    //! first value of frame t (0: oldest)
+    [[nodiscard]] T*
+    frame_data(size_type t) noexcept
+    {
+        return _values.data() + static_cast<std::size_t>(_slot(t)) * _strides[0];
+    }
+
+    [[nodiscard]] const T*
+    frame_data(size_type t) const noexcept
+    {
+        return _values.data() + static_cast<std::size_t>(_slot(t)) * _strides[0];
+    }
+
+    [[nodiscard]] span
+    frame(size_type t) noexcept
+    {
+        return span(frame_data(t), _strides[0]);
+    }
+
+    [[nodiscard]] const_span
+    frame(size_type t) const noexcept
+    {
+        return const_span(frame_data(t), _strides[0]);
+    }
+
+    //! the stored frames from oldest to newest as at most two contiguous ranges; the second one may be empty
+    [[nodiscard]] std::array<span, 2>
+    spans() noexcept
+    {
+        const auto [first, second] = _span_ranges();
+        return {span(_values.data() + first.first, first.second), span(_values.data(), second)};
+    }
+
+    [[nodiscard]] std::array<const_span, 2>
+    spans() const noexcept
+    {
+        const auto [first, second] = _span_ranges();
+        return {const_span(_values.data() + first.first, first.second), const_span(_values.data(), second)};
+    }
+
+  private:
+    //! ((offset, size) of the first range, size of the second range starting at slot 0)
+    [[nodiscard]] std::pair<std::pair<std::size_t, std::size_t>, std::size_t>
+    _span_ranges() const noexcept
+    {
+        const std::size_t frameSize = _strides[0];
+        const size_type   first     = std::min(_num_frames, capacity() - _head);
+
+        return {{_head * frameSize, first * frameSize}, (_num_frames - first) * frameSize};
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // access
+    //------------------------------------------------------------------------------------------------------
+    template<typename TIndexAccessible>
+    [[nodiscard]] std::size_t
+    _list_id(const TIndexAccessible& gid) const noexcept
+    {
+        std::size_t lid = static_cast<std::size_t>(_slot(static_cast<size_type>(gid[0]))) * _strides[0];
+
+        for (size_type k = 1; k < TDimensions; ++k)
+        {
+            assert(static_cast<size_type>(gid[k]) < _sizes[k] && "id out of bounds");
+            lid += static_cast<std::size_t>(gid[k]) * _strides[k];
+        }
+
+        return lid;
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] std::size_t
+    _list_id_of(const Ids& ... ids) const noexcept
+    {
+        constexpr bool isIndexPack = sizeof...(Ids) == TDimensions && std::conjunction_v<std::is_integral<Ids>...>;
+
+        static_assert(isIndexPack || sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+        if constexpr (isIndexPack)
+        {
+            return _list_id(std::array<size_type, TDimensions>{static_cast<size_type>(ids)...});
+        }
+        else
+        {
+            return _list_id(std::get<0>(std::forward_as_tuple(ids...)));
+        }
+    }
+
+  public:
+    //! value at (time, frame ids...); time 0 is the oldest frame
+    template<typename... Ids>
+    [[nodiscard]] reference
+    operator()(const Ids& ... ids) noexcept
+    {
+        return _values[_list_id_of(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] const_reference
+    operator()(const Ids& ... ids) const noexcept
+    {
+        return _values[_list_id_of(ids...)];
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // conversion
+    //------------------------------------------------------------------------------------------------------
+    //! copy with the frames in chronological order
+    [[nodiscard]] grid<T, TDimensions>
+    to_grid() const
+    {
+        grid<T, TDimensions> g;
+
+        if (empty())
+        {
+            return g;
+        }
+
+        const auto s = size();
+        g.resize(s.begin(), s.end(), T());
+
+        auto out = g.data().begin();
+
+        for (const const_span& sp: spans())
+        {
+            out = std::copy(sp.begin(), sp.end(), out);
+        }
+
+        return g;
+    }
+
+    //====================================================================================================
+    //===== SETTER
+    //====================================================================================================
+  private:
+    //! storage of the frame that becomes the newest one
+    [[nodiscard]] T*
+    _advance()
+    {
+        assert(!_values.empty() && "ring_grid has no capacity");
+
+        if (full())
+        {
+            const size_type slot = _head;
+            _head = _head + 1 == capacity() ? 0 : _head + 1;
+            return _values.data() + static_cast<std::size_t>(slot) * _strides[0];
+        }
+
+        ++_num_frames;
+        return frame_data(_num_frames - 1);
+    }
+
+  public:
+    //! appends a copy of frame as the newest frame; the oldest frame is dropped if full()
+    /*!
+     * throws std::invalid_argument if the frame sizes do not match
+     */
+    void
+    push_back(const frame_type& f)
+    {
+        for (size_type k = 1; k < TDimensions; ++k)
+        {
+            if (f.size(k - 1) != _sizes[k])
+            {
+                throw std::invalid_argument("ring_grid::push_back: frame size(" + std::to_string(k - 1) + ") is " + std::to_string(f.size(k - 1))
+                                            + ", expected " + std::to_string(_sizes[k]));
+            }
+        }
+
+        std::copy(f.data().begin(), f.data().end(), _advance());
+    }
+
+    //! appends frame_num_values() values in row-major frame order
+    template<typename TInputIterator>
+    void
+    push_back(TInputIterator first)
+    {
+        std::copy_n(first, _strides[0], _advance());
+    }
+
+    //! makes room for a new newest frame and returns it for in-place writing; its values are unspecified
+    [[nodiscard]] span
+    push_back_uninitialized()
+    {
+        return span(_advance(), _strides[0]);
+    }
+
+    //! drops the oldest frame
+    void
+    pop_front() noexcept
+    {
+        assert(!empty() && "ring_grid is empty");
+
+        _head = _head + 1 == capacity() ? 0 : _head + 1;
+        --_num_frames;
+    }
+
+    template<typename TIndex>
+    void
+    resize(std::initializer_list<TIndex> sizes)
+    {
+        assert(sizes.size() == num_dimensions() && "invalid number or sizes in initializer list");
+        resize(sizes.begin(), sizes.end());
+    }
+
+    //! sets capacity (first value) and frame sizes; removes all frames
+    template<typename TForwardIterator, std::enable_if_t<!std::is_arithmetic_v<std::decay_t<TForwardIterator>>>* = nullptr>
+    void
+    resize(TForwardIterator first, TForwardIterator last)
+    {
+        std::copy(first, last, _sizes.begin());
+        assert(std::all_of(_sizes.begin(), _sizes.end(), [](size_type x)
+        {
+            return x > 0;
+        }) && "all sizes must be > 0");
+
+        size_type s = 1;
+
+        for (size_type k = TDimensions; k-- > 0;)
+        {
+            _strides[k] = s;
+            s *= _sizes[k];
+        }
+
+        _values.assign(s, T());
+        _head       = 0;
+        _num_frames = 0;
+    }
+
+    //! removes all frames; capacity and frame sizes are kept
+    void
+    clear() noexcept
+    {
+        _head       = 0;
+        _num_frames = 0;
+    }
+
+    void
+    swap(self_type& other) noexcept
+    {
+        std::swap(_sizes, other._sizes);
+        std::swap(_strides, other._strides);
+        std::swap(_head, other._head);
+        std::swap(_num_frames, other._num_frames);
+        std::swap(_values, other._values);
+    }
+}; // class ring_grid
+} // namespace nd
+
+#endif //__ND_RING_GRID_H__h8g2f6d0s4a8p2o6i0u4y8t2r6e0w4
@@ -0,0 +1,446 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_SMALL_VECTOR_H__w3e7r1t5y9u3i7o1p5a9s3d7f1g5h9
+#define __ND_SMALL_VECTOR_H__w3e7r1t5y9u3i7o1p5a9s3d7f1g5h9
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//====================================================================================================
+//===== class small_vector
+//====================================================================================================
+/*
+ * contiguous container of trivially copyable values that keeps up to TInlineCapacity values inside the
+ * object and allocates only above that, e.g., per-dimension sizes and strides of nd::vector:
+ *
+ *     nd::small_vector<unsigned int, 8> sizes = {480, 640, 3}; // no allocation
+ *     sizes.push_back(2);
+ *
+ * - interface is a subset of std::vector
+ * - iterators and references are invalidated by moves, since inline values move with the object
+ */
+namespace nd
+{
+template<typename T, std::size_t TInlineCapacity>
+class small_vector
+{
+    static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>, "small_vector requires trivially copyable, default constructible values");
+    static_assert(TInlineCapacity > 0, "inline capacity must be greater than 0");
+
+  public:
+    using self_type = small_vector<T, TInlineCapacity>;
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    [[nodiscard]] static constexpr size_type
+    inline_capacity() noexcept
+    {
+        return TInlineCapacity;
+    }
+
+  private:
+    T*        _data;
+    size_type _size     = 0;
+    size_type _capacity = TInlineCapacity;
+    T         _inline[TInlineCapacity]{};
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    small_vector() noexcept :
+        _data(_inline)
+    {
+    }
+
+    explicit small_vector(size_type n, const T& value = T()) :
+        small_vector()
+    {
+        resize(n, value);
+    }
+
+    template<typename TForwardIterator, std::enable_if_t<!std::is_integral_v<TForwardIterator>>* = nullptr>
+    small_vector(TForwardIterator first, TForwardIterator last) :
+        small_vector()
+    {
+        assign(first, last);
+    }
+
+    small_vector(std::initializer_list<T> values) :
+        small_vector(values.begin(), values.end())
+    {
+    }
+
+    small_vector(const self_type& other) :
+        small_vector(other.begin(), other.end())
+    {
+    }
+
+    small_vector(self_type&& other) noexcept :
+        small_vector()
+    {
+        _steal(other);
+    }
+
+    ~small_vector()
+    {
+        _free();
+    }
+
+    self_type&
+    operator=(const self_type& other)
+    {
+        if (this != &other)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        return *this;
+    }
+
+    self_type&
+    operator=(self_type&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _free();
+            _data     = _inline;
+            _capacity = TInlineCapacity;
+            _steal(other);
+        }
+
+        return *this;
+    }
+
+    self_type&
+    operator=(std::initializer_list<T> values)
+    {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+  private:
+    [[nodiscard]] bool
+    _is_heap() const noexcept
+    {
+        return _data != _inline;
+    }
+
+    void
+    _free() noexcept
+    {
+        if (_is_heap())
+        {
+            delete[] _data;
+        }
+    }
+
+    //! expects this to be empty and inline
+    void
+    _steal(self_type& other) noexcept
+    {
+        if (other._is_heap())
+        {
+            _data     = other._data;
+            _capacity = other._capacity;
+        }
+        else
+        {
+            std::copy(other._inline, other._inline + other._size, _inline);
+        }
+
+        _size = other._size;
+
+        other._data     = other._inline;
+        other._size     = 0;
+        other._capacity = TInlineCapacity;
+    }
+
+    void
+    _reallocate(size_type capacity)
+    {
+        T* data = capacity <= TInlineCapacity ? _inline : new T[capacity];
+
+        if (data != _data)
+        {
+            std::copy(_data, _data + _size, data);
+            _free();
+        }
+
+        _data     = data;
+        _capacity = capacity <= TInlineCapacity ? TInlineCapacity : capacity;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // getter
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] size_type
+    size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] size_type
+    capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    //! true as long as the values are stored inside the object
+    [[nodiscard]] bool
+    is_inline() const noexcept
+    {
+        return !_is_heap();
+    }
+
+    [[nodiscard]] T*
+    data() noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] const T*
+    data() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] T&
+    operator[](size_type i) noexcept
+    {
+        assert(i < _size && "id out of bounds");
+        return _data[i];
+    }
+
+    [[nodiscard]] const T&
+    operator[](size_type i) const noexcept
+    {
+        assert(i < _size && "id out of bounds");
+        return _data[i];
+    }
+
+    [[nodiscard]] T&
+    front() noexcept
+    {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] const T&
+    front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] T&
+    back() noexcept
+    {
+        return (*this)[_size - 1];
+    }
+
+    [[nodiscard]] const T&
+    back() const noexcept
+    {
+        return (*this)[_size - 1];
+    }
+
+    [[nodiscard]] iterator
+    begin() noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] const_iterator
+    begin() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] const_iterator
+    cbegin() const noexcept
+    {
+        return _data;
+    }
+
+    [[nodiscard]] iterator
+    end() noexcept
+    {
+        return _data + _size;
+    }
+
+    [[nodiscard]] const_iterator
+    end() const noexcept
+    {
+        return _data + _size;
+    }
+
+    [[nodiscard]] const_iterator
+    cend() const noexcept
+    {
+        return _data + _size;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // setter
+    //------------------------------------------------------------------------------------------------------
+    template<typename TForwardIterator, std::enable_if_t<!std::is_integral_v<TForwardIterator>>* = nullptr>
+    void
+    assign(TForwardIterator first, TForwardIterator last)
+    {
+        const auto n = static_cast<size_type>(std::distance(first, last));
+
+        _size = 0;
+        reserve(n);
+
+        std::copy(first, last, _data);
+        _size = n;
+    }
+
+    void
+    reserve(size_type capacity)
+    {
+        if (capacity > _capacity)
+        {
+            _reallocate(capacity);
+        }
+    }
+
+    void
+    resize(size_type n, const T& value = T())
+    {
+        if (n > _capacity)
+        {
+            _reallocate(std::max(n, 2 * _capacity));
+        }
+
+        std::fill(_data + std::min(n, _size), _data + n, value);
+        _size = n;
+    }
+
+    void
+    push_back(const T& value)
+    {
+        const T v = value; // value may refer to an element
+
+        if (_size == _capacity)
+        {
+            _reallocate(2 * _capacity);
+        }
+
+        _data[_size++] = v;
+    }
+
+    void
+    pop_back() noexcept
+    {
+        assert(_size != 0 && "pop_back() on empty small_vector");
+        --_size;
+    }
+
+    void
+    clear() noexcept
+    {
+        _size = 0;
+    }
+
+    //! moves the values back inside the object if they fit, otherwise trims the allocation to size()
+    void
+    shrink_to_fit()
+    {
+        if (_is_heap() && _size < _capacity)
+        {
+            _reallocate(_size);
+        }
+    }
+
+    void
+    swap(self_type& other) noexcept
+    {
+        self_type tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // conversion
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] std::vector<T>
+    to_vector() const
+    {
+        return std::vector<T>(begin(), end());
+    }
+
+    //! keeps code working that stores or passes nd::vector::size() / strides() as std::vector
+    [[nodiscard]] operator std::vector<T>() const
+    {
+        return to_vector();
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // compare
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] friend bool
+    operator==(const self_type& a, const self_type& b) noexcept
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    [[nodiscard]] friend bool
+    operator!=(const self_type& a, const self_type& b) noexcept
+    {
+        return !(a == b);
+    }
+}; // class small_vector
+
+template<typename T, std::size_t TInlineCapacity>
+void
+swap(small_vector<T, TInlineCapacity>& a, small_vector<T, TInlineCapacity>& b) noexcept
+{
+    a.swap(b);
+}
+} // namespace nd
+
+#endif //__ND_SMALL_VECTOR_H__w3e7r1t5y9u3i7o1p5a9s3d7f1g5h9
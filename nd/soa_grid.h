@@ -0,0 +1,799 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_SOA_GRID_H__w4e8r2t6y0u4i8o2p6a0s4d8f2g6h0
+#define __ND_SOA_GRID_H__w4e8r2t6y0u4i8o2p6a0s4d8f2g6h0
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "grid.h"
+#include "parallel.h"
+
+//====================================================================================================
+//===== class soa_grid
+//====================================================================================================
+/*
+ * N-dimensional grid with one contiguous buffer per channel (structure of arrays):
+ *
+ *     nd::soa_grid<3, float, float, float> v(aos); // from nd::grid<std::array<float, 3>, 3>
+ *     auto [vx, vy, vz] = v(x, y, z);               // proxy: vx, vy, vz refer to the channels
+ *     v(x, y, z) = std::array<float, 3>{0, 0, 1};
+ *     float* vz = v.channel<2>().data();           // contiguous z components
+ *
+ * - operator() / operator[] return a proxy (soa_reference) that behaves like one element:
+ *   it can be assigned from / converted to std::tuple, std::array, nd::array and supports get<I>() / structured bindings
+ * - AoS elements can be std::array, std::tuple, std::pair or any type with operator[], e.g., nd::array
+ * - AoS <-> SoA conversion runs in parallel over blocks of values; per block and channel, the loop has constant stride
+ *   and no aliasing (restrict) so that the compiler vectorizes it
+ */
+namespace nd
+{
+template<typename... TChannels>
+class soa_reference;
+
+namespace detail
+{
+template<typename T>
+struct is_soa_reference : std::false_type
+{
+};
+
+template<typename... TChannels>
+struct is_soa_reference<soa_reference<TChannels...>> : std::true_type
+{
+};
+
+template<typename T, typename = void>
+struct is_tuple_like : std::false_type
+{
+};
+
+template<typename T>
+struct is_tuple_like<T, std::void_t<decltype(std::tuple_size<T>::value)>> : std::true_type
+{
+};
+
+//! channel I of an AoS element: std::get for tuple-like types, operator[] otherwise
+template<std::size_t I, typename TElement>
+[[nodiscard]] constexpr decltype(auto)
+aos_get(TElement& e) noexcept
+{
+    if constexpr (is_tuple_like<std::remove_const_t<TElement>>::value)
+    {
+        return std::get<I>(e);
+    }
+    else
+    {
+        return e[I];
+    }
+}
+} // namespace detail
+
+//------------------------------------------------------------------------------------------------------
+// proxy reference
+//------------------------------------------------------------------------------------------------------
+//! reference to one element of a soa_grid, i.e., one value per channel
+template<typename... TChannels>
+class soa_reference
+{
+  public:
+    using value_type = std::tuple<std::remove_const_t<TChannels>...>;
+
+  private:
+    std::tuple<TChannels& ...> _refs;
+
+    template<typename TElement, std::size_t... Is>
+    void
+    _assign(const TElement& e, std::index_sequence<Is...>)
+    {
+        ((std::get<Is>(_refs) = static_cast<std::remove_const_t<TChannels>>(detail::aos_get<Is>(e))), ...);
+    }
+
+  public:
+    explicit soa_reference(TChannels& ... refs) noexcept :
+        _refs(refs...)
+    {
+    }
+
+    soa_reference(const soa_reference&) = default;
+
+    //! assigns the values (not the references) of another element
+    soa_reference&
+    operator=(const soa_reference& other)
+    {
+        return *this = other.values();
+    }
+
+    //! assigns the values of an element with other constness, e.g., of a const soa_grid
+    template<typename... K, std::enable_if_t<!std::is_same_v<soa_reference<K...>, soa_reference>>* = nullptr>
+    soa_reference&
+    operator=(const soa_reference<K...>& other)
+    {
+        static_assert(sizeof...(K) == sizeof...(TChannels), "number of channels does not match");
+
+        return *this = other.values();
+    }
+
+    template<typename TElement, std::enable_if_t<!detail::is_soa_reference<std::decay_t<TElement>>::value>* = nullptr>
+    soa_reference&
+    operator=(const TElement& e)
+    {
+        if constexpr (detail::is_tuple_like<TElement>::value)
+        {
+            static_assert(std::tuple_size_v<TElement> == sizeof...(TChannels), "number of channels does not match");
+        }
+
+        _assign(e, std::index_sequence_for<TChannels...>());
+        return *this;
+    }
+
+    template<std::size_t I>
+    [[nodiscard]] auto&
+    get() const noexcept
+    {
+        return std::get<I>(_refs);
+    }
+
+    [[nodiscard]] value_type
+    values() const
+    {
+        return std::apply([](const auto& ... x)
+        {
+            return value_type(x...);
+        }, _refs);
+    }
+
+    [[nodiscard]] operator value_type() const
+    {
+        return values();
+    }
+
+    //! converts to an AoS element type, e.g., std::array< float, 3 > or nd::array< float, 3 >
+    template<typename TElement>
+    [[nodiscard]] TElement
+    as() const
+    {
+        TElement e{};
+        _copy_to(e, std::index_sequence_for<TChannels...>());
+        return e;
+    }
+
+  private:
+    template<typename TElement, std::size_t... Is>
+    void
+    _copy_to(TElement& e, std::index_sequence<Is...>) const
+    {
+        ((detail::aos_get<Is>(e) = std::get<Is>(_refs)), ...);
+    }
+
+  public:
+    template<typename... K>
+    [[nodiscard]] bool
+    operator==(const soa_reference<K...>& other) const
+    {
+        return values() == other.values();
+    }
+
+    template<typename... K>
+    [[nodiscard]] bool
+    operator!=(const soa_reference<K...>& other) const
+    {
+        return !operator==(other);
+    }
+
+    [[nodiscard]] bool
+    operator==(const value_type& other) const
+    {
+        return values() == other;
+    }
+
+    [[nodiscard]] bool
+    operator!=(const value_type& other) const
+    {
+        return !operator==(other);
+    }
+};
+
+template<std::size_t TDimensions, typename... TChannels>
+class soa_grid
+{
+    //------------------------------------------------------------------------------------------------------
+    // assertions
+    //------------------------------------------------------------------------------------------------------
+    static_assert(TDimensions > 0, "template num dimension must be greater than 0");
+    static_assert(sizeof...(TChannels) > 0, "at least one channel is required");
+
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] static constexpr std::size_t
+    num_dimensions() noexcept
+    {
+        return TDimensions;
+    }
+
+    [[nodiscard]] static constexpr std::size_t
+    num_channels() noexcept
+    {
+        return sizeof...(TChannels);
+    }
+
+    using self_type = soa_grid<TDimensions, TChannels...>;
+    using value_type = std::tuple<TChannels...>;
+    using data_container_type = std::tuple<std::vector<TChannels>...>;
+    using size_type = unsigned int;
+    using difference_type = int;
+    using reference = soa_reference<TChannels...>;
+    using const_reference = soa_reference<const TChannels...>;
+    template<std::size_t I>
+    using channel_type = std::tuple_element_t<I, value_type>;
+
+    //------------------------------------------------------------------------------------------------------
+    // iterator
+    //------------------------------------------------------------------------------------------------------
+  private:
+    //! visits all elements in list order; dereferencing yields a proxy
+    template<bool IsConst>
+    class _soa_iterator
+    {
+        friend class soa_grid;
+
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename soa_grid::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, typename soa_grid::const_reference, typename soa_grid::reference>;
+        using pointer = void;
+
+      private:
+        using grid_pointer = std::conditional_t<IsConst, const soa_grid*, soa_grid*>;
+
+        grid_pointer _grid = nullptr;
+        size_type    _lid  = 0;
+
+        _soa_iterator(grid_pointer g, size_type lid) :
+            _grid(g)
+            , _lid(lid)
+        {
+        }
+
+      public:
+        _soa_iterator() = default;
+
+        [[nodiscard]] reference
+        operator*() const
+        {
+            return (*_grid)[_lid];
+        }
+
+        _soa_iterator&
+        operator++() noexcept
+        {
+            ++_lid;
+            return *this;
+        }
+
+        _soa_iterator
+        operator++(int) noexcept
+        {
+            _soa_iterator tmp = *this;
+            ++_lid;
+            return tmp;
+        }
+
+        [[nodiscard]] size_type
+        list_id() const noexcept
+        {
+            return _lid;
+        }
+
+        [[nodiscard]] bool
+        operator==(const _soa_iterator& other) const noexcept
+        {
+            return _lid == other._lid;
+        }
+
+        [[nodiscard]] bool
+        operator!=(const _soa_iterator& other) const noexcept
+        {
+            return _lid != other._lid;
+        }
+    };
+
+  public:
+    using iterator = _soa_iterator<false>;
+    using const_iterator = _soa_iterator<true>;
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    std::array<size_type, TDimensions> _sizes{};
+    std::array<size_type, TDimensions> _strides{};
+    data_container_type                _channels;
+
+    //! values per block in AoS <-> SoA conversion; a block of AoS elements stays in L1 / L2 while its channels are written
+    static constexpr std::size_t _block_size = 2048;
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    soa_grid() = default;
+
+    soa_grid(const self_type&) = default;
+
+    soa_grid(self_type&&) noexcept = default;
+
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) == TDimensions && std::conjunction_v<std::is_integral<std::decay_t<TSizes>>...>>* = nullptr>
+    explicit soa_grid(TSizes... sizes)
+    {
+        resize({static_cast<size_type>(sizes)...}, value_type());
+    }
+
+    template<typename TIndex>
+    soa_grid(std::initializer_list<TIndex> sizes, const value_type& defaultInitValue = value_type())
+    {
+        resize(sizes, defaultInitValue);
+    }
+
+    //! splits the channels of an AoS grid, e.g., nd::grid< std::array< float, 3 >, N >
+    /*!
+     * numThreads == 0 picks the number of threads from the hardware and the grid size.
+     */
+    template<typename TElement>
+    explicit soa_grid(const grid<TElement, TDimensions>& aos, unsigned int numThreads = 0)
+    {
+        _check_element<TElement>();
+
+        if (aos.empty())
+        {
+            return;
+        }
+
+        _resize_channels(aos.size().begin(), aos.size().end());
+
+        const TElement* src = aos.data().data();
+
+        _for_each_block(numThreads, [&](std::size_t first, std::size_t last)
+        {
+            _deinterleave(src, first, last, std::index_sequence_for<TChannels...>());
+        });
+    }
+
+    ~soa_grid() = default;
+
+    self_type&
+    operator=(const self_type&) = default;
+
+    self_type&
+    operator=(self_type&&) noexcept = default;
+
+    //------------------------------------------------------------------------------------------------------
+    // conversion to AoS
+    //------------------------------------------------------------------------------------------------------
+    //! interleaves the channels into an AoS grid, e.g., to_grid< std::array< float, 3 > >()
+    template<typename TElement = value_type>
+    [[nodiscard]] grid<TElement, TDimensions>
+    to_grid(unsigned int numThreads = 0) const
+    {
+        _check_element<TElement>();
+
+        grid<TElement, TDimensions> aos;
+
+        if (empty())
+        {
+            return aos;
+        }
+
+        aos.resize(_sizes.begin(), _sizes.end(), TElement());
+
+        TElement* dst = aos.data().data();
+
+        _for_each_block(numThreads, [&](std::size_t first, std::size_t last)
+        {
+            _interleave(dst, first, last, std::index_sequence_for<TChannels...>());
+        });
+
+        return aos;
+    }
+
+  private:
+    template<typename TElement>
+    static constexpr void
+    _check_element() noexcept
+    {
+        if constexpr (detail::is_tuple_like<TElement>::value)
+        {
+            static_assert(std::tuple_size_v<TElement> == num_channels(), "number of channels does not match");
+        }
+    }
+
+    template<typename TFunction>
+    void
+    _for_each_block(unsigned int numThreads, TFunction&& f) const
+    {
+        const std::size_t n         = num_values();
+        const std::size_t numBlocks = (n + _block_size - 1) / _block_size;
+
+        numThreads = detail::num_threads(numThreads, n * (sizeof(TChannels) + ...));
+
+        detail::parallel_for_range(numThreads, numBlocks, [&](std::size_t firstBlock, std::size_t lastBlock)
+        {
+            for (std::size_t b = firstBlock; b < lastBlock; ++b)
+            {
+                f(b * _block_size, std::min(n, (b + 1) * _block_size));
+            }
+        });
+    }
+
+    template<typename TElement, std::size_t... Is>
+    void
+    _deinterleave(const TElement* src, std::size_t first, std::size_t last, std::index_sequence<Is...>)
+    {
+        (_deinterleave_channel<Is>(src, first, last), ...);
+    }
+
+    template<std::size_t I, typename TElement>
+    void
+    _deinterleave_channel(const TElement* __restrict src, std::size_t first, std::size_t last)
+    {
+        using T = channel_type<I>;
+
+        T* __restrict dst = std::get<I>(_channels).data();
+
+        for (std::size_t i = first; i < last; ++i)
+        {
+            dst[i] = static_cast<T>(detail::aos_get<I>(src[i]));
+        }
+    }
+
+    template<typename TElement, std::size_t... Is>
+    void
+    _interleave(TElement* dst, std::size_t first, std::size_t last, std::index_sequence<Is...>) const
+    {
+        (_interleave_channel<Is>(dst, first, last), ...);
+    }
+
+    template<std::size_t I, typename TElement>
+    void
+    _interleave_channel(TElement* __restrict dst, std::size_t first, std::size_t last) const
+    {
+        using T = std::remove_reference_t<decltype(detail::aos_get<I>(*dst))>;
+
+        const channel_type<I>* __restrict src = std::get<I>(_channels).data();
+
+        for (std::size_t i = first; i < last; ++i)
+        {
+            detail::aos_get<I>(dst[i]) = static_cast<T>(src[i]);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // sizes / strides
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] const std::array<size_type, TDimensions>&
+    size() const noexcept
+    {
+        return _sizes;
+    }
+
+    [[nodiscard]] size_type
+    size(size_type dimId) const
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _sizes[dimId];
+    }
+
+    [[nodiscard]] const std::array<size_type, TDimensions>&
+    strides() const noexcept
+    {
+        return _strides;
+    }
+
+    [[nodiscard]] size_type
+    stride(size_type dimId) const
+    {
+        return _strides[dimId];
+    }
+
+    [[nodiscard]] size_type
+    num_values() const noexcept
+    {
+        return static_cast<size_type>(std::get<0>(_channels).size());
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return std::get<0>(_channels).empty();
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // channels
+    //------------------------------------------------------------------------------------------------------
+    //! contiguous buffer of channel I in list order
+    template<std::size_t I>
+    [[nodiscard]] std::vector<channel_type<I>>&
+    channel() noexcept
+    {
+        return std::get<I>(_channels);
+    }
+
+    template<std::size_t I>
+    [[nodiscard]] const std::vector<channel_type<I>>&
+    channel() const noexcept
+    {
+        return std::get<I>(_channels);
+    }
+
+    //! value of channel I at a grid position
+    template<std::size_t I, typename... Ids>
+    [[nodiscard]] channel_type<I>&
+    get(const Ids& ... ids)
+    {
+        return std::get<I>(_channels)[grid_to_list_id(ids...)];
+    }
+
+    template<std::size_t I, typename... Ids>
+    [[nodiscard]] const channel_type<I>&
+    get(const Ids& ... ids) const
+    {
+        return std::get<I>(_channels)[grid_to_list_id(ids...)];
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // list id / grid id conversion
+    //------------------------------------------------------------------------------------------------------
+    template<typename... Ids>
+    [[nodiscard]] size_type
+    grid_to_list_id(const Ids& ... ids) const
+    {
+        constexpr bool isIndexPack = sizeof...(Ids) == TDimensions && std::conjunction_v<std::is_integral<Ids>...>;
+
+        static_assert(isIndexPack || sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+        if constexpr (isIndexPack)
+        {
+            return _grid_to_list_id(std::index_sequence_for<Ids...>(), ids...);
+        }
+        else
+        {
+            const auto& gid = std::get<0>(std::forward_as_tuple(ids...));
+            size_type   lid = 0;
+
+            for (size_type k = 0; k < TDimensions; ++k)
+            {
+                lid += static_cast<size_type>(gid[k]) * _strides[k];
+            }
+
+            return lid;
+        }
+    }
+
+  private:
+    template<std::size_t... Is, typename... Ids>
+    [[nodiscard]] size_type
+    _grid_to_list_id(std::index_sequence<Is...>, const Ids& ... ids) const noexcept
+    {
+        return (0U + ... + (static_cast<size_type>(ids) * _strides[Is]));
+    }
+
+  public:
+    [[nodiscard]] std::array<size_type, TDimensions>
+    list_to_grid_id(size_type lid) const
+    {
+        assert(lid < num_values());
+
+        std::array<size_type, TDimensions> gid{};
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            gid[k] = lid / _strides[k];
+            lid -= gid[k] * _strides[k];
+        }
+
+        return gid;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // access
+    //------------------------------------------------------------------------------------------------------
+  private:
+    template<typename TSelf, std::size_t... Is>
+    [[nodiscard]] static auto
+    _make_reference(TSelf& self, size_type lid, std::index_sequence<Is...>)
+    {
+        using ref = std::conditional_t<std::is_const_v<TSelf>, const_reference, reference>;
+        return ref(std::get<Is>(self._channels)[lid]...);
+    }
+
+  public:
+    [[nodiscard]] reference
+    operator[](size_type lid)
+    {
+        assert(lid < num_values() && "id out of bounds");
+        return _make_reference(*this, lid, std::index_sequence_for<TChannels...>());
+    }
+
+    [[nodiscard]] const_reference
+    operator[](size_type lid) const
+    {
+        assert(lid < num_values() && "id out of bounds");
+        return _make_reference(*this, lid, std::index_sequence_for<TChannels...>());
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] reference
+    operator()(const Ids& ... ids)
+    {
+        return operator[](grid_to_list_id(ids...));
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] const_reference
+    operator()(const Ids& ... ids) const
+    {
+        return operator[](grid_to_list_id(ids...));
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // iterators
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] iterator
+    begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    [[nodiscard]] const_iterator
+    begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    [[nodiscard]] iterator
+    end() noexcept
+    {
+        return iterator(this, num_values());
+    }
+
+    [[nodiscard]] const_iterator
+    end() const noexcept
+    {
+        return const_iterator(this, num_values());
+    }
+
+    //====================================================================================================
+    //===== SETTER
+    //====================================================================================================
+  private:
+    template<typename TForwardIterator>
+    void
+    _resize_channels(TForwardIterator first, TForwardIterator last)
+    {
+        std::copy(first, last, _sizes.begin());
+        assert(std::all_of(_sizes.begin(), _sizes.end(), [](size_type x)
+        {
+            return x > 0;
+        }) && "all sizes must be > 0");
+
+        size_type s = 1U;
+
+        for (size_type k = TDimensions; k-- > 0;)
+        {
+            _strides[k] = s;
+            s *= _sizes[k];
+        }
+
+        std::apply([s](auto& ... c)
+        {
+            (c.resize(s), ...);
+        }, _channels);
+    }
+
+  public:
+    template<typename T>
+    void
+    resize(std::initializer_list<T> sizes, const value_type& defaultInitValue)
+    {
+        assert(sizes.size() == num_dimensions() && "invalid number or sizes in initializer list");
+        resize(sizes.begin(), sizes.end(), defaultInitValue);
+    }
+
+    //! sets new sizes; all values are set to defaultInitValue
+    template<typename TForwardIterator, std::enable_if_t<!std::is_arithmetic_v<std::decay_t<TForwardIterator>>>* = nullptr>
+    void
+    resize(TForwardIterator first, TForwardIterator last, const value_type& defaultInitValue)
+    {
+        _resize_channels(first, last);
+        fill(defaultInitValue);
+    }
+
+    void
+    clear()
+    {
+        _sizes.fill(0);
+        _strides.fill(0);
+
+        std::apply([](auto& ... c)
+        {
+            (c.clear(), ...);
+        }, _channels);
+    }
+
+    void
+    fill(const value_type& value)
+    {
+        _fill(value, std::index_sequence_for<TChannels...>());
+    }
+
+    void
+    swap(self_type& other) noexcept
+    {
+        std::swap(_sizes, other._sizes);
+        std::swap(_strides, other._strides);
+        std::swap(_channels, other._channels);
+    }
+
+  private:
+    template<std::size_t... Is>
+    void
+    _fill(const value_type& value, std::index_sequence<Is...>)
+    {
+        (std::fill(std::get<Is>(_channels).begin(), std::get<Is>(_channels).end(), std::get<Is>(value)), ...);
+    }
+}; // class soa_grid
+} // namespace nd
+
+//------------------------------------------------------------------------------------------------------
+// structured bindings for soa_reference
+//------------------------------------------------------------------------------------------------------
+template<typename... TChannels>
+struct std::tuple_size<nd::soa_reference<TChannels...>> : std::integral_constant<std::size_t, sizeof...(TChannels)>
+{
+};
+
+template<std::size_t I, typename... TChannels>
+struct std::tuple_element<I, nd::soa_reference<TChannels...>>
+{
+    using type = std::tuple_element_t<I, std::tuple<TChannels& ...>>;
+};
+
+#endif //__ND_SOA_GRID_H__w4e8r2t6y0u4i8o2p6a0s4d8f2g6h0
@@ -0,0 +1,769 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_SPARSE_GRID_H__e1r5t9y3u7i1o5p9a3s7d1f5g9h3j7
+#define __ND_SPARSE_GRID_H__e1r5t9y3u7i1o5p9a3s7d1f5g9h3j7
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bitgrid.h"
+#include "grid.h"
+#include "parallel.h"
+
+//====================================================================================================
+//===== class sparse_grid
+//====================================================================================================
+/*
+ * N-dimensional sparse grid: dense leaf blocks of (2^LeafLog2)^N values in a hash table, everything else is background
+ *
+ *     nd::sparse_grid<float, 3> sdf(dense_sdf, 3.0F, 0.0F); // voxels != background become active
+ *     sdf.touch(x, y, z) = -1;                             // allocates the leaf if required, activates the voxel
+ *     const float v = sdf(x, y, z);                        // background if not active
+ *     sdf.for_each_active([](const auto& gid, float& v) { ... });
+ *
+ * - random access is one hash lookup of the leaf plus shifts / masks inside the leaf (O(1) on average)
+ * - each leaf stores an activity bit mask; inactive voxels hold the background value
+ * - leaves() gives direct access to all allocated blocks; for_each_active() iterates the set mask bits
+ * - topology_union() / topology_intersection() combine the active sets of two grids like in OpenVDB
+ * - conversion from / to nd::grid runs in parallel over leaf blocks
+ */
+namespace nd
+{
+template<typename T, std::size_t TDimensions, std::size_t TLeafLog2 = 3>
+class sparse_grid
+{
+    //------------------------------------------------------------------------------------------------------
+    // assertions
+    //------------------------------------------------------------------------------------------------------
+    static_assert(TDimensions > 0, "template num dimension must be greater than 0");
+    static_assert(TLeafLog2 > 0 && TDimensions * TLeafLog2 <= 24, "leaf blocks must have between 2 and 2^24 values");
+
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] static constexpr std::size_t
+    num_dimensions() noexcept
+    {
+        return TDimensions;
+    }
+
+    using self_type = sparse_grid<T, TDimensions, TLeafLog2>;
+    using value_type = T;
+    using size_type = unsigned int;
+    using difference_type = int;
+    using grid_id_type = std::array<size_type, TDimensions>;
+    using mask_word_type = std::uint64_t;
+
+    //! values per leaf and dimension
+    static constexpr size_type leaf_size = size_type(1) << TLeafLog2;
+    //! values per leaf
+    static constexpr size_type leaf_num_values = size_type(1) << (TDimensions * TLeafLog2);
+    static constexpr size_type leaf_num_mask_words = (leaf_num_values + 63) / 64;
+
+    //! dense block of leaf_size^N values; local ids are row-major (last dimension fastest)
+    struct leaf_type
+    {
+        grid_id_type                                          origin{};
+        std::array<value_type, leaf_num_values>               values{};
+        std::array<mask_word_type, leaf_num_mask_words>       mask{};
+
+        [[nodiscard]] bool
+        is_active(size_type localId) const noexcept
+        {
+            return (mask[localId / 64] >> (localId % 64)) & 1U;
+        }
+
+        void
+        set_active(size_type localId) noexcept
+        {
+            mask[localId / 64] |= mask_word_type(1) << (localId % 64);
+        }
+
+        void
+        set_inactive(size_type localId) noexcept
+        {
+            mask[localId / 64] &= ~(mask_word_type(1) << (localId % 64));
+        }
+
+        [[nodiscard]] size_type
+        num_active() const noexcept
+        {
+            size_type n = 0;
+
+            for (const mask_word_type w: mask)
+            {
+                n += detail::popcount64(w);
+            }
+
+            return n;
+        }
+
+        [[nodiscard]] bool
+        empty() const noexcept
+        {
+            return std::all_of(mask.begin(), mask.end(), [](mask_word_type w)
+            {
+                return w == 0;
+            });
+        }
+
+        //! grid id of a local id
+        [[nodiscard]] grid_id_type
+        grid_id(size_type localId) const noexcept
+        {
+            grid_id_type gid = origin;
+
+            for (size_type k = TDimensions; k-- > 0;)
+            {
+                gid[k] += localId & (leaf_size - 1);
+                localId >>= TLeafLog2;
+            }
+
+            return gid;
+        }
+
+        //! calls f(localId) for each active value
+        template<typename TFunction>
+        void
+        for_each_active(TFunction&& f) const
+        {
+            for (size_type w = 0; w < leaf_num_mask_words; ++w)
+            {
+                for (mask_word_type bits = mask[w]; bits != 0; bits &= bits - 1)
+                {
+                    f(w * 64 + detail::countr_zero64(bits));
+                }
+            }
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    grid_id_type                               _sizes{};
+    //! strides of the (coarse) grid of leaves; leaf keys are row-major leaf ids
+    std::array<std::size_t, TDimensions>       _leaf_strides{};
+    value_type                                 _background{};
+    std::vector<leaf_type>                     _leaves;
+    std::unordered_map<std::size_t, size_type> _leaf_ids;
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    sparse_grid() = default;
+
+    sparse_grid(const self_type&) = default;
+
+    sparse_grid(self_type&&) noexcept = default;
+
+    template<typename TIndex>
+    sparse_grid(std::initializer_list<TIndex> sizes, const value_type& background = value_type())
+    {
+        resize(sizes, background);
+    }
+
+    //! all dense values that differ from background by more than tolerance become active
+    /*!
+     * numThreads == 0 picks the number of threads from the hardware and the grid size.
+     */
+    template<layout TLayout>
+    sparse_grid(const grid<T, TDimensions, TLayout>& dense, const value_type& background, const value_type& tolerance = value_type(),
+                unsigned int numThreads = 0)
+    {
+        if (dense.empty())
+        {
+            _background = background;
+            return;
+        }
+
+        resize(dense.size().begin(), dense.size().end(), background);
+
+        const std::size_t numLeaves = num_leaves_dense();
+
+        numThreads = detail::num_threads(numThreads, dense.num_values() * sizeof(T));
+        numThreads = static_cast<unsigned int>(std::max<std::size_t>(1, std::min<std::size_t>(numThreads, numLeaves)));
+
+        std::vector<std::vector<leaf_type>> leavesPerThread(numThreads);
+        const auto& values = dense.data(); // by list id: grid<bool>::operator() cannot return a reference
+
+        detail::parallel_for(numThreads, [&](unsigned int t)
+        {
+            std::vector<leaf_type>& leaves = leavesPerThread[t];
+            leaf_type                l;
+
+            for (std::size_t key = numLeaves * t / numThreads; key < numLeaves * (t + 1) / numThreads; ++key)
+            {
+                _init_leaf(l, key);
+                bool any = false;
+
+                _for_each_valid(l.origin, [&](size_type localId, const grid_id_type& gid)
+                {
+                    const value_type& v = values[dense.grid_to_list_id(gid)];
+
+                    if (_differs(v, tolerance))
+                    {
+                        l.values[localId] = v;
+                        l.set_active(localId);
+                        any = true;
+                    }
+                });
+
+                if (any)
+                {
+                    leaves.push_back(l);
+                }
+            }
+        });
+
+        for (std::vector<leaf_type>& leaves: leavesPerThread)
+        {
+            for (leaf_type& l: leaves)
+            {
+                _leaf_ids.emplace(_leaf_key(l.origin), static_cast<size_type>(_leaves.size()));
+                _leaves.push_back(std::move(l));
+            }
+        }
+    }
+
+    ~sparse_grid() = default;
+
+    self_type&
+    operator=(const self_type&) = default;
+
+    self_type&
+    operator=(self_type&&) noexcept = default;
+
+    //------------------------------------------------------------------------------------------------------
+    // conversion
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] grid<T, TDimensions>
+    to_grid(unsigned int numThreads = 0) const
+    {
+        grid<T, TDimensions> dense;
+
+        if (empty())
+        {
+            return dense;
+        }
+
+        dense.resize(_sizes.begin(), _sizes.end(), _background);
+
+        // std::vector<bool> packs the values of different leaves into shared words, so write them serially
+        numThreads = std::is_same_v<T, bool> ? 1 : detail::num_threads(numThreads, _leaves.size() * sizeof(leaf_type));
+
+        auto& values = dense.data(); // by list id: grid<bool>::operator() cannot return a reference
+
+        detail::parallel_for_range(numThreads, _leaves.size(), [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                const leaf_type& l = _leaves[i];
+
+                l.for_each_active([&](size_type localId)
+                {
+                    values[dense.grid_to_list_id(l.grid_id(localId))] = l.values[localId];
+                });
+            }
+        });
+
+        return dense;
+    }
+
+  private:
+    [[nodiscard]] bool
+    _differs(const value_type& v, const value_type& tolerance) const
+    {
+        if constexpr (std::is_arithmetic_v<value_type>)
+        {
+            return (v > _background ? v - _background : _background - v) > tolerance;
+        }
+        else
+        {
+            return !(v == _background);
+        }
+    }
+
+    //! calls f(localId, gid) for all leaf values inside the grid
+    template<typename TFunction>
+    void
+    _for_each_valid(const grid_id_type& origin, TFunction&& f) const
+    {
+        grid_id_type extent{};
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            extent[k] = std::min(leaf_size, _sizes[k] - origin[k]);
+        }
+
+        grid_id_type local{};
+
+        while (true)
+        {
+            size_type    localId = 0;
+            grid_id_type gid{};
+
+            for (size_type k = 0; k < TDimensions; ++k)
+            {
+                localId = (localId << TLeafLog2) | local[k];
+                gid[k]  = origin[k] + local[k];
+            }
+
+            f(localId, gid);
+
+            size_type k = TDimensions;
+
+            while (k-- > 0)
+            {
+                if (++local[k] < extent[k])
+                {
+                    break;
+                }
+
+                local[k] = 0;
+            }
+
+            if (k == static_cast<size_type>(-1))
+            {
+                return;
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // sizes
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] const grid_id_type&
+    size() const noexcept
+    {
+        return _sizes;
+    }
+
+    [[nodiscard]] size_type
+    size(size_type dimId) const
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _sizes[dimId];
+    }
+
+    //! number of values of the equivalent dense grid
+    [[nodiscard]] std::size_t
+    num_values() const noexcept
+    {
+        std::size_t n = 1;
+
+        for (const size_type s: _sizes)
+        {
+            n *= s;
+        }
+
+        return n;
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return _sizes[0] == 0;
+    }
+
+    [[nodiscard]] const value_type&
+    background() const noexcept
+    {
+        return _background;
+    }
+
+    //! number of leaf blocks that fit into the dense sizes
+    [[nodiscard]] std::size_t
+    num_leaves_dense() const noexcept
+    {
+        return empty() ? 0 : _leaf_strides[0] * ((_sizes[0] + leaf_size - 1) >> TLeafLog2);
+    }
+
+    [[nodiscard]] std::size_t
+    num_leaves() const noexcept
+    {
+        return _leaves.size();
+    }
+
+    [[nodiscard]] const std::vector<leaf_type>&
+    leaves() const noexcept
+    {
+        return _leaves;
+    }
+
+    [[nodiscard]] std::vector<leaf_type>&
+    leaves() noexcept
+    {
+        return _leaves;
+    }
+
+    [[nodiscard]] std::size_t
+    num_active() const noexcept
+    {
+        std::size_t n = 0;
+
+        for (const leaf_type& l: _leaves)
+        {
+            n += l.num_active();
+        }
+
+        return n;
+    }
+
+    //! approximate number of bytes used by leaves and hash table
+    [[nodiscard]] std::size_t
+    memory_usage() const noexcept
+    {
+        return _leaves.capacity() * sizeof(leaf_type) + _leaf_ids.size() * (sizeof(std::size_t) + sizeof(size_type) + 2 * sizeof(void*))
+               + _leaf_ids.bucket_count() * sizeof(void*);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // access
+    //------------------------------------------------------------------------------------------------------
+  private:
+    template<typename TIndexAccessible>
+    [[nodiscard]] std::size_t
+    _leaf_key(const TIndexAccessible& gid) const noexcept
+    {
+        std::size_t key = 0;
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            assert(static_cast<size_type>(gid[k]) < _sizes[k] && "id out of bounds");
+            key += static_cast<std::size_t>(static_cast<size_type>(gid[k]) >> TLeafLog2) * _leaf_strides[k];
+        }
+
+        return key;
+    }
+
+    template<typename TIndexAccessible>
+    [[nodiscard]] static size_type
+    _local_id(const TIndexAccessible& gid) noexcept
+    {
+        size_type localId = 0;
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            localId = (localId << TLeafLog2) | (static_cast<size_type>(gid[k]) & (leaf_size - 1));
+        }
+
+        return localId;
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] static decltype(auto)
+    _as_grid_id(const Ids& ... ids) noexcept
+    {
+        constexpr bool isIndexPack = sizeof...(Ids) == TDimensions && std::conjunction_v<std::is_integral<Ids>...>;
+
+        static_assert(isIndexPack || sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+        if constexpr (isIndexPack)
+        {
+            return grid_id_type{static_cast<size_type>(ids)...};
+        }
+        else
+        {
+            return std::get<0>(std::forward_as_tuple(ids...));
+        }
+    }
+
+    void
+    _init_leaf(leaf_type& l, std::size_t key) const
+    {
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            l.origin[k] = static_cast<size_type>(key / _leaf_strides[k]) << TLeafLog2;
+            key %= _leaf_strides[k];
+        }
+
+        l.values.fill(_background);
+        l.mask.fill(0);
+    }
+
+    [[nodiscard]] leaf_type*
+    _find_leaf(std::size_t key) noexcept
+    {
+        const auto it = _leaf_ids.find(key);
+        return it == _leaf_ids.end() ? nullptr : &_leaves[it->second];
+    }
+
+    [[nodiscard]] const leaf_type*
+    _find_leaf(std::size_t key) const noexcept
+    {
+        const auto it = _leaf_ids.find(key);
+        return it == _leaf_ids.end() ? nullptr : &_leaves[it->second];
+    }
+
+    leaf_type&
+    _touch_leaf(std::size_t key)
+    {
+        const auto [it, inserted] = _leaf_ids.emplace(key, static_cast<size_type>(_leaves.size()));
+
+        if (inserted)
+        {
+            _leaves.emplace_back();
+            _init_leaf(_leaves.back(), key);
+        }
+
+        return _leaves[it->second];
+    }
+
+  public:
+    //! value at the position; background if not active
+    template<typename... Ids>
+    [[nodiscard]] const value_type&
+    operator()(const Ids& ... ids) const
+    {
+        const auto&      gid = _as_grid_id(ids...);
+        const leaf_type* l   = _find_leaf(_leaf_key(gid));
+
+        return l == nullptr ? _background : l->values[_local_id(gid)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] bool
+    is_active(const Ids& ... ids) const
+    {
+        const auto&      gid = _as_grid_id(ids...);
+        const leaf_type* l   = _find_leaf(_leaf_key(gid));
+
+        return l != nullptr && l->is_active(_local_id(gid));
+    }
+
+    //! activates the value (allocating its leaf if required) and returns a reference to it
+    template<typename... Ids>
+    value_type&
+    touch(const Ids& ... ids)
+    {
+        const auto&     gid     = _as_grid_id(ids...);
+        leaf_type&      l       = _touch_leaf(_leaf_key(gid));
+        const size_type localId = _local_id(gid);
+
+        l.set_active(localId);
+        return l.values[localId];
+    }
+
+    template<typename TIndexAccessible>
+    void
+    set_value(const TIndexAccessible& gid, const value_type& value)
+    {
+        touch(gid) = value;
+    }
+
+    //! resets the value to background and deactivates it; the leaf is kept until prune()
+    template<typename... Ids>
+    void
+    deactivate(const Ids& ... ids)
+    {
+        const auto& gid = _as_grid_id(ids...);
+
+        if (leaf_type* l = _find_leaf(_leaf_key(gid)))
+        {
+            const size_type localId = _local_id(gid);
+            l->values[localId] = _background;
+            l->set_inactive(localId);
+        }
+    }
+
+    //! leaf containing the position; nullptr if not allocated
+    template<typename... Ids>
+    [[nodiscard]] const leaf_type*
+    find_leaf(const Ids& ... ids) const
+    {
+        return _find_leaf(_leaf_key(_as_grid_id(ids...)));
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // iteration
+    //------------------------------------------------------------------------------------------------------
+    //! calls f(gid, value) for each active value, leaf by leaf
+    template<typename TFunction>
+    void
+    for_each_active(TFunction&& f)
+    {
+        for (leaf_type& l: _leaves)
+        {
+            l.for_each_active([&](size_type localId)
+            {
+                f(l.grid_id(localId), l.values[localId]);
+            });
+        }
+    }
+
+    template<typename TFunction>
+    void
+    for_each_active(TFunction&& f) const
+    {
+        for (const leaf_type& l: _leaves)
+        {
+            l.for_each_active([&](size_type localId)
+            {
+                f(l.grid_id(localId), l.values[localId]);
+            });
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // topology
+    //------------------------------------------------------------------------------------------------------
+    //! activates all values that are active in other; newly activated values keep their current value
+    template<typename K>
+    self_type&
+    topology_union(const sparse_grid<K, TDimensions, TLeafLog2>& other)
+    {
+        assert(_sizes == other.size() && "sizes must match");
+
+        for (const auto& ol: other.leaves())
+        {
+            leaf_type& l = _touch_leaf(_leaf_key(ol.origin));
+
+            for (size_type w = 0; w < leaf_num_mask_words; ++w)
+            {
+                l.mask[w] |= ol.mask[w];
+            }
+        }
+
+        return *this;
+    }
+
+    //! deactivates all values that are not active in other and removes empty leaves
+    template<typename K>
+    self_type&
+    topology_intersection(const sparse_grid<K, TDimensions, TLeafLog2>& other)
+    {
+        assert(_sizes == other.size() && "sizes must match");
+
+        for (leaf_type& l: _leaves)
+        {
+            const auto* ol = other.find_leaf(l.origin);
+
+            for (size_type w = 0; w < leaf_num_mask_words; ++w)
+            {
+                const mask_word_type keep    = ol == nullptr ? 0 : ol->mask[w];
+                mask_word_type       removed = l.mask[w] & ~keep;
+
+                l.mask[w] &= keep;
+
+                for (; removed != 0; removed &= removed - 1)
+                {
+                    l.values[w * 64 + detail::countr_zero64(removed)] = _background;
+                }
+            }
+        }
+
+        prune();
+        return *this;
+    }
+
+    //! removes leaves without active values
+    void
+    prune()
+    {
+        _leaves.erase(std::remove_if(_leaves.begin(), _leaves.end(), [](const leaf_type& l)
+        {
+            return l.empty();
+        }), _leaves.end());
+
+        _leaf_ids.clear();
+
+        for (size_type i = 0; i < _leaves.size(); ++i)
+        {
+            _leaf_ids.emplace(_leaf_key(_leaves[i].origin), i);
+        }
+    }
+
+    //====================================================================================================
+    //===== SETTER
+    //====================================================================================================
+    template<typename TIndex>
+    void
+    resize(std::initializer_list<TIndex> sizes, const value_type& background = value_type())
+    {
+        assert(sizes.size() == num_dimensions() && "invalid number or sizes in initializer list");
+        resize(sizes.begin(), sizes.end(), background);
+    }
+
+    //! sets new sizes and background; removes all leaves
+    template<typename TForwardIterator, std::enable_if_t<!std::is_arithmetic_v<std::decay_t<TForwardIterator>>>* = nullptr>
+    void
+    resize(TForwardIterator first, TForwardIterator last, const value_type& background = value_type())
+    {
+        std::copy(first, last, _sizes.begin());
+        assert(std::all_of(_sizes.begin(), _sizes.end(), [](size_type x)
+        {
+            return x > 0;
+        }) && "all sizes must be > 0");
+
+        std::size_t s = 1;
+
+        for (size_type k = TDimensions; k-- > 0;)
+        {
+            _leaf_strides[k] = s;
+            s *= (_sizes[k] + leaf_size - 1) >> TLeafLog2;
+        }
+
+        _background = background;
+        _leaves.clear();
+        _leaf_ids.clear();
+    }
+
+    void
+    clear()
+    {
+        _sizes.fill(0);
+        _leaf_strides.fill(0);
+        _leaves.clear();
+        _leaf_ids.clear();
+    }
+
+    void
+    swap(self_type& other) noexcept
+    {
+        std::swap(_sizes, other._sizes);
+        std::swap(_leaf_strides, other._leaf_strides);
+        std::swap(_background, other._background);
+        std::swap(_leaves, other._leaves);
+        std::swap(_leaf_ids, other._leaf_ids);
+    }
+}; // class sparse_grid
+} // namespace nd
+
+#endif //__ND_SPARSE_GRID_H__e1r5t9y3u7i1o5p9a3s7d1f5g9h3j7
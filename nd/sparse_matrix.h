@@ -0,0 +1,540 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_SPARSE_MATRIX_H__m2n6b0v4c8x2z6l0k4j8h2g6f0d4s8
+#define __ND_SPARSE_MATRIX_H__m2n6b0v4c8x2z6l0k4j8h2g6f0d4s8
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "grid.h"
+#include "parallel.h"
+
+//====================================================================================================
+//===== classes coo_matrix / sparse_matrix
+//====================================================================================================
+/*
+ * sparse matrices for iterative solvers:
+ *
+ *     nd::coo_matrix<double> coo(n, n);        // assembly: unordered (row, col, value) triplets, duplicates allowed
+ *     coo.add(i, j, a);
+ *     const nd::sparse_matrix<double> A(coo); // compressed sparse rows; duplicates are summed
+ *     const nd::grid<double, 1> y = A * x;    // x: nd::grid< double, 1 >
+ *
+ * - COO -> CSR: parallel counting sort by row (stable), then per-row sort by column and duplicate summation
+ * - nd::grid< T, 2 > -> CSR: values with |v| > threshold are kept; rows are counted and filled in parallel
+ * - SpMV splits the rows into ranges of about equal numbers of non-zeros per thread
+ */
+namespace nd
+{
+//------------------------------------------------------------------------------------------------------
+// COO
+//------------------------------------------------------------------------------------------------------
+template<typename T>
+class coo_matrix
+{
+  public:
+    using value_type = T;
+    using size_type = unsigned int;
+
+  private:
+    size_type              _num_rows = 0;
+    size_type              _num_cols = 0;
+    std::vector<size_type> _row_ids;
+    std::vector<size_type> _col_ids;
+    std::vector<T>         _values;
+
+  public:
+    coo_matrix() = default;
+
+    coo_matrix(size_type numRows, size_type numCols) :
+        _num_rows(numRows)
+        , _num_cols(numCols)
+    {
+    }
+
+    void
+    reserve(std::size_t numEntries)
+    {
+        _row_ids.reserve(numEntries);
+        _col_ids.reserve(numEntries);
+        _values.reserve(numEntries);
+    }
+
+    //! appends an entry; entries with the same position are summed on conversion to CSR
+    void
+    add(size_type row, size_type col, const T& value)
+    {
+        assert(row < _num_rows && col < _num_cols && "id out of bounds");
+
+        _row_ids.push_back(row);
+        _col_ids.push_back(col);
+        _values.push_back(value);
+    }
+
+    void
+    clear() noexcept
+    {
+        _row_ids.clear();
+        _col_ids.clear();
+        _values.clear();
+    }
+
+    [[nodiscard]] size_type
+    num_rows() const noexcept
+    {
+        return _num_rows;
+    }
+
+    [[nodiscard]] size_type
+    num_cols() const noexcept
+    {
+        return _num_cols;
+    }
+
+    [[nodiscard]] std::size_t
+    num_entries() const noexcept
+    {
+        return _values.size();
+    }
+
+    [[nodiscard]] const std::vector<size_type>&
+    row_ids() const noexcept
+    {
+        return _row_ids;
+    }
+
+    [[nodiscard]] const std::vector<size_type>&
+    col_ids() const noexcept
+    {
+        return _col_ids;
+    }
+
+    [[nodiscard]] const std::vector<T>&
+    values() const noexcept
+    {
+        return _values;
+    }
+}; // class coo_matrix
+
+//------------------------------------------------------------------------------------------------------
+// CSR
+//------------------------------------------------------------------------------------------------------
+template<typename T>
+class sparse_matrix
+{
+  public:
+    using self_type = sparse_matrix<T>;
+    using value_type = T;
+    using size_type = unsigned int;
+
+  private:
+    size_type              _num_rows = 0;
+    size_type              _num_cols = 0;
+    //! entries of row r are [_row_offsets[r], _row_offsets[r + 1]), sorted by column
+    std::vector<size_type> _row_offsets{0};
+    std::vector<size_type> _col_ids;
+    std::vector<T>         _values;
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    sparse_matrix() = default;
+
+    //! empty (all zero) matrix
+    sparse_matrix(size_type numRows, size_type numCols) :
+        _num_rows(numRows)
+        , _num_cols(numCols)
+        , _row_offsets(static_cast<std::size_t>(numRows) + 1, 0)
+    {
+    }
+
+    //! CSR from COO; entries with the same position are summed
+    /*!
+     * numThreads == 0 picks the number of threads from the hardware and the number of entries.
+     */
+    explicit sparse_matrix(const coo_matrix<T>& coo, unsigned int numThreads = 0) :
+        sparse_matrix(coo.num_rows(), coo.num_cols())
+    {
+        const std::size_t n = coo.num_entries();
+
+        if (n == 0)
+        {
+            return;
+        }
+
+        numThreads = detail::num_threads(numThreads, n * (2 * sizeof(size_type) + sizeof(T)));
+        numThreads = static_cast<unsigned int>(std::min<std::size_t>(numThreads, n));
+
+        const auto& rowIds = coo.row_ids();
+        const auto& colIds = coo.col_ids();
+        const auto& values = coo.values();
+
+        // 1. entries per row and thread
+        std::vector<std::vector<size_type>> positions(numThreads, std::vector<size_type>(_num_rows, 0));
+
+        detail::parallel_for(numThreads, [&](unsigned int t)
+        {
+            std::vector<size_type>& counts = positions[t];
+
+            for (std::size_t i = n * t / numThreads; i < n * (t + 1) / numThreads; ++i)
+            {
+                ++counts[rowIds[i]];
+            }
+        });
+
+        // 2. start position of each (row, thread) block; entries keep their input order within a row
+        std::vector<size_type> rowStarts(static_cast<std::size_t>(_num_rows) + 1, 0);
+        size_type              pos = 0;
+
+        for (size_type r = 0; r < _num_rows; ++r)
+        {
+            rowStarts[r] = pos;
+
+            for (std::vector<size_type>& counts: positions)
+            {
+                const size_type c = counts[r];
+                counts[r] = pos;
+                pos += c;
+            }
+        }
+
+        rowStarts[_num_rows] = pos;
+
+        // 3. scatter
+        std::vector<size_type> cols(n);
+        std::vector<T>         vals(n);
+
+        detail::parallel_for(numThreads, [&](unsigned int t)
+        {
+            std::vector<size_type>& p = positions[t];
+
+            for (std::size_t i = n * t / numThreads; i < n * (t + 1) / numThreads; ++i)
+            {
+                const size_type dst = p[rowIds[i]]++;
+                cols[dst] = colIds[i];
+                vals[dst] = values[i];
+            }
+        });
+
+        positions.clear();
+
+        // 4. sort each row by column and sum duplicates in place
+        std::vector<size_type> rowSizes(_num_rows);
+
+        detail::parallel_for_range(numThreads, _num_rows, [&](std::size_t first, std::size_t last)
+        {
+            std::vector<std::pair<size_type, T>> row;
+
+            for (std::size_t r = first; r < last; ++r)
+            {
+                const size_type begin = rowStarts[r];
+                const size_type end   = rowStarts[r + 1];
+
+                row.clear();
+
+                for (size_type i = begin; i < end; ++i)
+                {
+                    row.emplace_back(cols[i], vals[i]);
+                }
+
+                std::stable_sort(row.begin(), row.end(), [](const auto& a, const auto& b)
+                {
+                    return a.first < b.first;
+                });
+
+                size_type out = begin;
+
+                for (std::size_t i = 0; i < row.size(); ++out)
+                {
+                    cols[out] = row[i].first;
+                    vals[out] = row[i].second;
+
+                    for (++i; i < row.size() && row[i].first == cols[out]; ++i)
+                    {
+                        vals[out] += row[i].second;
+                    }
+                }
+
+                rowSizes[r] = out - begin;
+            }
+        });
+
+        // 5. compact
+        for (size_type r = 0; r < _num_rows; ++r)
+        {
+            _row_offsets[r + 1] = _row_offsets[r] + rowSizes[r];
+        }
+
+        _col_ids.resize(_row_offsets[_num_rows]);
+        _values.resize(_row_offsets[_num_rows]);
+
+        detail::parallel_for_range(numThreads, _num_rows, [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t r = first; r < last; ++r)
+            {
+                std::copy_n(cols.begin() + rowStarts[r], rowSizes[r], _col_ids.begin() + _row_offsets[r]);
+                std::copy_n(vals.begin() + rowStarts[r], rowSizes[r], _values.begin() + _row_offsets[r]);
+            }
+        });
+    }
+
+    //! CSR from a dense matrix (dimension 0: rows, dimension 1: columns); keeps values with |v| > threshold
+    template<layout TLayout>
+    explicit sparse_matrix(const grid<T, 2, TLayout>& dense, const T& threshold = T(0), unsigned int numThreads = 0) :
+        sparse_matrix(dense.size(0), dense.size(1))
+    {
+        if (dense.empty())
+        {
+            return;
+        }
+
+        const auto keep = [&](const T& v)
+        {
+            if constexpr (std::is_unsigned_v<T>)
+            {
+                return v > threshold;
+            }
+            else
+            {
+                using std::abs;
+                return abs(v) > threshold;
+            }
+        };
+
+        numThreads = detail::num_threads(numThreads, dense.num_values() * sizeof(T));
+
+        std::vector<size_type> rowSizes(_num_rows, 0);
+
+        detail::parallel_for_range(numThreads, _num_rows, [&](std::size_t first, std::size_t last)
+        {
+            for (size_type r = static_cast<size_type>(first); r < last; ++r)
+            {
+                for (size_type c = 0; c < _num_cols; ++c)
+                {
+                    rowSizes[r] += keep(dense(r, c));
+                }
+            }
+        });
+
+        for (size_type r = 0; r < _num_rows; ++r)
+        {
+            _row_offsets[r + 1] = _row_offsets[r] + rowSizes[r];
+        }
+
+        _col_ids.resize(_row_offsets[_num_rows]);
+        _values.resize(_row_offsets[_num_rows]);
+
+        detail::parallel_for_range(numThreads, _num_rows, [&](std::size_t first, std::size_t last)
+        {
+            for (size_type r = static_cast<size_type>(first); r < last; ++r)
+            {
+                size_type out = _row_offsets[r];
+
+                for (size_type c = 0; c < _num_cols; ++c)
+                {
+                    const T& v = dense(r, c);
+
+                    if (keep(v))
+                    {
+                        _col_ids[out] = c;
+                        _values[out]  = v;
+                        ++out;
+                    }
+                }
+            }
+        });
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // getter
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] size_type
+    num_rows() const noexcept
+    {
+        return _num_rows;
+    }
+
+    [[nodiscard]] size_type
+    num_cols() const noexcept
+    {
+        return _num_cols;
+    }
+
+    [[nodiscard]] std::size_t
+    num_nonzeros() const noexcept
+    {
+        return _values.size();
+    }
+
+    [[nodiscard]] const std::vector<size_type>&
+    row_offsets() const noexcept
+    {
+        return _row_offsets;
+    }
+
+    [[nodiscard]] const std::vector<size_type>&
+    col_ids() const noexcept
+    {
+        return _col_ids;
+    }
+
+    [[nodiscard]] const std::vector<T>&
+    values() const noexcept
+    {
+        return _values;
+    }
+
+    //! non-zero values can be modified, the pattern cannot
+    [[nodiscard]] std::vector<T>&
+    values() noexcept
+    {
+        return _values;
+    }
+
+    //! value at (row, col); T(0) if not stored. Binary search in the row
+    [[nodiscard]] T
+    operator()(size_type row, size_type col) const
+    {
+        assert(row < _num_rows && col < _num_cols && "id out of bounds");
+
+        const auto first = _col_ids.begin() + _row_offsets[row];
+        const auto last  = _col_ids.begin() + _row_offsets[row + 1];
+        const auto it    = std::lower_bound(first, last, col);
+
+        return it != last && *it == col ? _values[static_cast<std::size_t>(it - _col_ids.begin())] : T(0);
+    }
+
+    [[nodiscard]] grid<T, 2>
+    to_grid() const
+    {
+        grid<T, 2> dense({_num_rows, _num_cols}, T(0));
+
+        for (size_type r = 0; r < _num_rows; ++r)
+        {
+            for (size_type i = _row_offsets[r]; i < _row_offsets[r + 1]; ++i)
+            {
+                dense(r, _col_ids[i]) = _values[i];
+            }
+        }
+
+        return dense;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // SpMV
+    //------------------------------------------------------------------------------------------------------
+    //! y = A * x; y is resized if required
+    /*!
+     * - throws std::invalid_argument if x.size(0) != num_cols()
+     * - x and y may be the same grid (square A); the product is then computed into a temporary
+     * - numThreads == 0 picks the number of threads from the hardware and the number of non-zeros
+     */
+    void
+    multiply(const grid<T, 1>& x, grid<T, 1>& y, unsigned int numThreads = 0) const
+    {
+        if (x.num_values() != _num_cols)
+        {
+            throw std::invalid_argument("sparse_matrix::multiply: x has " + std::to_string(x.num_values()) + " values, expected " + std::to_string(_num_cols));
+        }
+
+        if (&x == &y)
+        {
+            // the restrict pointers below must not alias
+            grid<T, 1> tmp;
+            multiply(x, tmp, numThreads);
+            y.swap(tmp);
+            return;
+        }
+
+        if (_num_rows == 0)
+        {
+            y.clear();
+            return;
+        }
+
+        if (y.num_values() != _num_rows)
+        {
+            y.resize({_num_rows}, T(0));
+        }
+
+        numThreads = detail::num_threads(numThreads, num_nonzeros() * (sizeof(size_type) + sizeof(T)));
+        numThreads = static_cast<unsigned int>(std::max<std::size_t>(1, std::min<std::size_t>(numThreads, _num_rows)));
+
+        const size_type* __restrict offsets = _row_offsets.data();
+        const size_type* __restrict cols    = _col_ids.data();
+        const T* __restrict         vals    = _values.data();
+        const T* __restrict         xs      = x.data().data();
+        T* __restrict               ys      = y.data().data();
+
+        detail::parallel_for(numThreads, [&](unsigned int t)
+        {
+            const size_type first = _row_by_nonzeros(num_nonzeros() * t / numThreads);
+            const size_type last  = t + 1 == numThreads ? _num_rows : _row_by_nonzeros(num_nonzeros() * (t + 1) / numThreads);
+
+            for (size_type r = first; r < last; ++r)
+            {
+                T sum = T(0);
+
+                for (size_type i = offsets[r]; i < offsets[r + 1]; ++i)
+                {
+                    sum += vals[i] * xs[cols[i]];
+                }
+
+                ys[r] = sum;
+            }
+        });
+    }
+
+    [[nodiscard]] grid<T, 1>
+    operator*(const grid<T, 1>& x) const
+    {
+        grid<T, 1> y;
+        multiply(x, y);
+        return y;
+    }
+
+  private:
+    //! first row whose entries start at or after the nnz-th entry
+    [[nodiscard]] size_type
+    _row_by_nonzeros(std::size_t nnz) const noexcept
+    {
+        const auto it = std::lower_bound(_row_offsets.begin(), _row_offsets.end() - 1, nnz);
+        return static_cast<size_type>(it - _row_offsets.begin());
+    }
+}; // class sparse_matrix
+} // namespace nd
+
+#endif //__ND_SPARSE_MATRIX_H__m2n6b0v4c8x2z6l0k4j8h2g6f0d4s8
@@ -0,0 +1,865 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifndef __ND_TILED_GRID_H__m3n7b1v5c9x2z6l4k8j0h3g7f1d5s9
+#define __ND_TILED_GRID_H__m3n7b1v5c9x2z6l4k8j0h3g7f1d5s9
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "grid.h"
+#include "parallel.h"
+
+//====================================================================================================
+//===== class tiled_grid
+//====================================================================================================
+/*
+ * N-dimensional grid stored in bricks (tiles) of compile-time size, e.g., 8x8x8:
+ *
+ *     nd::tiled_grid<float, 3>          v(512, 512, 512); // 8x8x8 bricks (default)
+ *     nd::tiled_grid<float, 3, 16, 16, 4> w(512, 512, 512); // 16x16x4 bricks
+ *
+ * - the values of a brick are contiguous (last dimension fastest within the brick),
+ *   bricks are stored one after another (last dimension fastest in brick order).
+ *   Neighbourhood operations thus touch a few bricks instead of rows that are far apart
+ * - brick sizes are powers of two, so operator() splits an index via shifts and masks only
+ * - bricks at the upper borders are padded; padding values are part of data() but are neither accessible via operator()
+ *   nor visited by the iterators
+ * - begin() / end() iterate over all values in brick order; it.grid_id() returns the position of the current value
+ */
+namespace nd
+{
+namespace detail
+{
+[[nodiscard]] constexpr bool
+is_power_of_two(std::size_t x) noexcept
+{
+    return x != 0 && (x & (x - 1)) == 0;
+}
+
+[[nodiscard]] constexpr unsigned int
+log2_of_power_of_two(std::size_t x) noexcept
+{
+    unsigned int n = 0;
+
+    while (x > 1)
+    {
+        x >>= 1;
+        ++n;
+    }
+
+    return n;
+}
+
+template<std::size_t TDimensions, std::size_t... TBrickSizes>
+[[nodiscard]] constexpr std::array<unsigned int, TDimensions>
+brick_sizes() noexcept
+{
+    if constexpr (sizeof...(TBrickSizes) == 0)
+    {
+        std::array<unsigned int, TDimensions> s{};
+
+        for (std::size_t i = 0; i < TDimensions; ++i)
+        {
+            s[i] = 8U;
+        }
+
+        return s;
+    }
+    else
+    {
+        return std::array<unsigned int, TDimensions>{{static_cast<unsigned int>(TBrickSizes)...}};
+    }
+}
+
+template<std::size_t TDimensions>
+[[nodiscard]] constexpr std::array<unsigned int, TDimensions>
+brick_shifts(const std::array<unsigned int, TDimensions>& sizes) noexcept
+{
+    std::array<unsigned int, TDimensions> s{};
+
+    for (std::size_t i = 0; i < TDimensions; ++i)
+    {
+        s[i] = log2_of_power_of_two(sizes[i]);
+    }
+
+    return s;
+}
+
+//! shifts that place the within-brick index of dimension i (last dimension fastest)
+template<std::size_t TDimensions>
+[[nodiscard]] constexpr std::array<unsigned int, TDimensions>
+brick_inner_shifts(const std::array<unsigned int, TDimensions>& shifts) noexcept
+{
+    std::array<unsigned int, TDimensions> s{};
+    unsigned int                          shift = 0;
+
+    for (std::size_t i = TDimensions; i-- > 0;)
+    {
+        s[i] = shift;
+        shift += shifts[i];
+    }
+
+    return s;
+}
+
+//! compile-time shape of the bricks of a tiled_grid; 8 per dimension if no sizes are given
+template<std::size_t TDimensions, std::size_t... TBrickSizes>
+struct brick_shape
+{
+    static_assert(sizeof...(TBrickSizes) == 0 || sizeof...(TBrickSizes) == TDimensions, "provide either no or N brick sizes");
+    static_assert((is_power_of_two(TBrickSizes) && ...), "brick sizes must be powers of two");
+
+    using array_type = std::array<unsigned int, TDimensions>;
+
+    static constexpr array_type   sizes        = brick_sizes<TDimensions, TBrickSizes...>();
+    static constexpr array_type   shifts       = brick_shifts<TDimensions>(sizes);
+    static constexpr array_type   inner_shifts = brick_inner_shifts<TDimensions>(shifts);
+    static constexpr unsigned int volume_shift = inner_shifts[0] + shifts[0];
+    static constexpr unsigned int volume       = 1U << volume_shift;
+};
+} // namespace detail
+
+template<typename TValue, std::size_t TDimensions, std::size_t... TBrickSizes>
+class tiled_grid
+{
+    //------------------------------------------------------------------------------------------------------
+    // assertions
+    //------------------------------------------------------------------------------------------------------
+    static_assert(TDimensions > 0, "template num dimension must be greater than 0");
+
+    //------------------------------------------------------------------------------------------------------
+    // definitions
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] static constexpr std::size_t
+    num_dimensions() noexcept
+    {
+        return TDimensions;
+    }
+
+    using self_type = tiled_grid<TValue, TDimensions, TBrickSizes...>;
+    using value_type = TValue;
+    using data_container_type = std::vector<value_type>;
+    using size_type = unsigned int;
+    using difference_type = int;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using grid_id_type = std::array<size_type, TDimensions>;
+
+  private:
+    using shape = detail::brick_shape<TDimensions, TBrickSizes...>;
+
+  public:
+    //! size of a brick along dimension dimId
+    [[nodiscard]] static constexpr size_type
+    brick_size(size_type dimId) noexcept
+    {
+        return shape::sizes[dimId];
+    }
+
+    //! number of values per brick (incl. padding)
+    [[nodiscard]] static constexpr size_type
+    brick_num_values() noexcept
+    {
+        return shape::volume;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // iterator
+    //------------------------------------------------------------------------------------------------------
+  private:
+    //! visits all values in brick order, skipping the padding of border bricks
+    template<bool IsConst>
+    class _brick_iterator
+    {
+        friend class tiled_grid;
+        template<bool> friend class _brick_iterator;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename tiled_grid::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+      private:
+        using grid_pointer = std::conditional_t<IsConst, const tiled_grid*, tiled_grid*>;
+
+        grid_pointer _grid = nullptr;
+        grid_id_type _brick{};
+        grid_id_type _inner{};
+        grid_id_type _limits{};
+        size_type    _lid   = 0;
+
+        _brick_iterator(grid_pointer g, size_type lid) :
+            _grid(g)
+            , _lid(lid)
+        {
+            if (_lid == 0)
+            {
+                _update_limits();
+            }
+        }
+
+        void
+        _update_limits() noexcept
+        {
+            for (size_type k = 0; k < TDimensions; ++k)
+            {
+                _limits[k] = std::min(brick_size(k), _grid->_sizes[k] - (_brick[k] << shape::shifts[k]));
+            }
+        }
+
+        void
+        _next_brick() noexcept
+        {
+            for (size_type k = TDimensions; k-- > 0;)
+            {
+                if (++_brick[k] < _grid->_num_bricks[k])
+                {
+                    _lid = _grid->_brick_list_id(_brick) << shape::volume_shift;
+                    _update_limits();
+                    return;
+                }
+
+                _brick[k] = 0;
+            }
+
+            _lid = static_cast<size_type>(_grid->_values.size()); // end
+        }
+
+      public:
+        _brick_iterator() = default;
+
+        //! converts iterator to const_iterator
+        template<bool C = IsConst, std::enable_if_t<C>* = nullptr>
+        _brick_iterator(const _brick_iterator<false>& other) :
+            _grid(other._grid)
+            , _brick(other._brick)
+            , _inner(other._inner)
+            , _limits(other._limits)
+            , _lid(other._lid)
+        {
+        }
+
+        [[nodiscard]] reference
+        operator*() const
+        {
+            return _grid->_values[_lid];
+        }
+
+        [[nodiscard]] pointer
+        operator->() const
+        {
+            return &_grid->_values[_lid];
+        }
+
+        _brick_iterator&
+        operator++() noexcept
+        {
+            for (size_type k = TDimensions; k-- > 0;)
+            {
+                if (++_inner[k] < _limits[k])
+                {
+                    _lid += size_type(1) << shape::inner_shifts[k];
+                    return *this;
+                }
+
+                _lid -= (_inner[k] - 1) << shape::inner_shifts[k];
+                _inner[k] = 0;
+            }
+
+            _next_brick();
+            return *this;
+        }
+
+        _brick_iterator
+        operator++(int) noexcept
+        {
+            _brick_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        //! position of the current value in the grid
+        [[nodiscard]] grid_id_type
+        grid_id() const noexcept
+        {
+            grid_id_type gid{};
+
+            for (size_type k = 0; k < TDimensions; ++k)
+            {
+                gid[k] = (_brick[k] << shape::shifts[k]) + _inner[k];
+            }
+
+            return gid;
+        }
+
+        //! position of the current brick in the grid of bricks
+        [[nodiscard]] const grid_id_type&
+        brick_id() const noexcept
+        {
+            return _brick;
+        }
+
+        //! index of the current value in data()
+        [[nodiscard]] size_type
+        list_id() const noexcept
+        {
+            return _lid;
+        }
+
+        [[nodiscard]] bool
+        operator==(const _brick_iterator& other) const noexcept
+        {
+            return _lid == other._lid;
+        }
+
+        [[nodiscard]] bool
+        operator!=(const _brick_iterator& other) const noexcept
+        {
+            return _lid != other._lid;
+        }
+    };
+
+  public:
+    using iterator = _brick_iterator<false>;
+    using const_iterator = _brick_iterator<true>;
+
+    //------------------------------------------------------------------------------------------------------
+    // members
+    //------------------------------------------------------------------------------------------------------
+  private:
+    grid_id_type        _sizes{};
+    grid_id_type        _num_bricks{};
+    grid_id_type        _brick_strides{};
+    data_container_type _values;
+
+    //------------------------------------------------------------------------------------------------------
+    // class
+    //------------------------------------------------------------------------------------------------------
+  public:
+    tiled_grid() = default;
+
+    tiled_grid(const self_type&) = default;
+
+    tiled_grid(self_type&&) noexcept = default;
+
+    template<typename... TSizes, std::enable_if_t<sizeof...(TSizes) == TDimensions && std::conjunction_v<std::is_integral<std::decay_t<TSizes>>...>>* = nullptr>
+    explicit tiled_grid(TSizes... sizes)
+    {
+        resize({static_cast<size_type>(sizes)...}, value_type());
+    }
+
+    template<typename TIndex>
+    tiled_grid(std::initializer_list<TIndex> sizes, const value_type& defaultInitValue = value_type())
+    {
+        resize(sizes, defaultInitValue);
+    }
+
+    //! copies a grid brick by brick; each thread handles a contiguous range of bricks
+    /*!
+     * numThreads == 0 picks the number of threads from the hardware and the grid size.
+     */
+    template<typename K>
+    explicit tiled_grid(const grid<K, TDimensions>& g, unsigned int numThreads = 0)
+    {
+        static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
+
+        if (g.empty())
+        {
+            return;
+        }
+
+        resize(g.size().begin(), g.size().end(), value_type());
+
+        const K* src = g.data().data();
+
+        _for_each_brick_row(g.strides(), numThreads, [&](size_type tiledLid, size_type gridLid, size_type n)
+        {
+            std::copy_n(src + gridLid, n, _values.data() + tiledLid);
+        });
+    }
+
+    ~tiled_grid() = default;
+
+    self_type&
+    operator=(const self_type&) = default;
+
+    self_type&
+    operator=(self_type&&) noexcept = default;
+
+    //------------------------------------------------------------------------------------------------------
+    // conversion to grid
+    //------------------------------------------------------------------------------------------------------
+    //! copies the values to a grid brick by brick; each thread handles a contiguous range of bricks
+    template<typename K = value_type>
+    [[nodiscard]] grid<K, TDimensions>
+    to_grid(unsigned int numThreads = 0) const
+    {
+        static_assert(std::is_convertible_v<value_type, K>, "cannot cast types");
+
+        grid<K, TDimensions> g;
+
+        if (empty())
+        {
+            return g;
+        }
+
+        g.resize(_sizes.begin(), _sizes.end(), K());
+
+        K* dst = g.data().data();
+
+        _for_each_brick_row(g.strides(), numThreads, [&](size_type tiledLid, size_type gridLid, size_type n)
+        {
+            std::copy_n(_values.data() + tiledLid, n, dst + gridLid);
+        });
+
+        return g;
+    }
+
+  private:
+    //! calls f(tiled list id, grid list id, n) for each run of n values that is contiguous in both storages
+    /*!
+     * runs are brick rows along the last dimension; bricks are distributed over the threads
+     */
+    template<typename TFunction>
+    void
+    _for_each_brick_row(const grid_id_type& gridStrides, unsigned int numThreads, TFunction&& f) const
+    {
+        const std::size_t numBricksTotal = num_bricks();
+
+        numThreads = detail::num_threads(numThreads, _values.size() * sizeof(value_type));
+
+        detail::parallel_for_range(numThreads, numBricksTotal, [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t b = first; b < last; ++b)
+            {
+                // brick position from the brick list id
+                grid_id_type brick{};
+                std::size_t  rest = b;
+
+                for (size_type k = 0; k < TDimensions; ++k)
+                {
+                    brick[k] = static_cast<size_type>(rest / _brick_strides[k]);
+                    rest -= brick[k] * static_cast<std::size_t>(_brick_strides[k]);
+                }
+
+                grid_id_type limits{};
+                size_type    gridLid = 0;
+
+                for (size_type k = 0; k < TDimensions; ++k)
+                {
+                    const size_type origin = brick[k] << shape::shifts[k];
+
+                    limits[k] = std::min(brick_size(k), _sizes[k] - origin);
+                    gridLid += origin * gridStrides[k];
+                }
+
+                const size_type rowLength = limits[TDimensions - 1];
+                size_type       tiledLid  = static_cast<size_type>(b) << shape::volume_shift;
+
+                if constexpr (TDimensions == 1)
+                {
+                    f(tiledLid, gridLid, rowLength);
+                }
+                else
+                {
+                    // odometer over the rows of the brick, i.e., dimensions 0, ..., N-2
+                    grid_id_type inner{};
+
+                    for (;;)
+                    {
+                        f(tiledLid, gridLid, rowLength);
+
+                        size_type k = TDimensions - 1;
+
+                        while (k-- > 0)
+                        {
+                            if (++inner[k] < limits[k])
+                            {
+                                tiledLid += size_type(1) << shape::inner_shifts[k];
+                                gridLid += gridStrides[k];
+                                break;
+                            }
+
+                            tiledLid -= (inner[k] - 1) << shape::inner_shifts[k];
+                            gridLid -= (inner[k] - 1) * gridStrides[k];
+                            inner[k] = 0;
+                        }
+
+                        if (k == static_cast<size_type>(-1))
+                        {
+                            break;
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // sizes
+    //------------------------------------------------------------------------------------------------------
+  public:
+    [[nodiscard]] const grid_id_type&
+    size() const noexcept
+    {
+        return _sizes;
+    }
+
+    [[nodiscard]] size_type
+    size(size_type dimId) const
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _sizes[dimId];
+    }
+
+    //! number of values excluding padding
+    [[nodiscard]] size_type
+    num_values() const noexcept
+    {
+        size_type n = 1;
+
+        for (size_type s: _sizes)
+        {
+            n *= s;
+        }
+
+        return n;
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return _values.empty();
+    }
+
+    //! number of bricks along dimension dimId
+    [[nodiscard]] size_type
+    num_bricks(size_type dimId) const
+    {
+        assert(dimId < num_dimensions() && "dimId exceeds num_dimensions()");
+        return _num_bricks[dimId];
+    }
+
+    //! total number of bricks
+    [[nodiscard]] size_type
+    num_bricks() const noexcept
+    {
+        return static_cast<size_type>(_values.size() >> shape::volume_shift);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // data
+    //------------------------------------------------------------------------------------------------------
+    //! brick-contiguous storage incl. padding
+    [[nodiscard]] data_container_type&
+    data() & noexcept
+    {
+        return _values;
+    }
+
+    [[nodiscard]] const data_container_type&
+    data() const& noexcept
+    {
+        return _values;
+    }
+
+    //! first value of brick brickId (brick list id); brick_num_values() values follow
+    [[nodiscard]] pointer
+    brick_data(size_type brickId) noexcept
+    {
+        assert(brickId < num_bricks());
+        return _values.data() + (static_cast<std::size_t>(brickId) << shape::volume_shift);
+    }
+
+    [[nodiscard]] const_pointer
+    brick_data(size_type brickId) const noexcept
+    {
+        assert(brickId < num_bricks());
+        return _values.data() + (static_cast<std::size_t>(brickId) << shape::volume_shift);
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // list id / grid id conversion
+    //------------------------------------------------------------------------------------------------------
+  private:
+    template<typename TIndexAccessible>
+    [[nodiscard]] size_type
+    _brick_list_id(const TIndexAccessible& brick) const noexcept
+    {
+        size_type lid = 0;
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            lid += brick[k] * _brick_strides[k];
+        }
+
+        return lid;
+    }
+
+    template<std::size_t... Is, typename... Ids>
+    [[nodiscard]] size_type
+    _grid_to_list_id_pack(std::index_sequence<Is...>, Ids... ids) const noexcept
+    {
+        const size_type brick = (0U + ... + ((static_cast<size_type>(ids) >> shape::shifts[Is]) * _brick_strides[Is]));
+        const size_type inner = (0U + ... + ((static_cast<size_type>(ids) & (shape::sizes[Is] - 1)) << shape::inner_shifts[Is]));
+
+        return (brick << shape::volume_shift) + inner;
+    }
+
+    template<typename TIndexAccessible>
+    [[nodiscard]] size_type
+    _grid_to_list_id_index(const TIndexAccessible& gid) const noexcept
+    {
+        size_type brick = 0;
+        size_type inner = 0;
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            const auto i = static_cast<size_type>(gid[k]);
+
+            brick += (i >> shape::shifts[k]) * _brick_strides[k];
+            inner += (i & (shape::sizes[k] - 1)) << shape::inner_shifts[k];
+        }
+
+        return (brick << shape::volume_shift) + inner;
+    }
+
+  public:
+    //! index in data() of the value at the given grid position
+    template<typename... Ids>
+    [[nodiscard]] size_type
+    grid_to_list_id(const Ids& ... ids) const
+    {
+        constexpr bool isIndexPack = sizeof...(Ids) == TDimensions && std::conjunction_v<std::is_integral<Ids>...>;
+
+        static_assert(isIndexPack || sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+        if constexpr (isIndexPack)
+        {
+            return _grid_to_list_id_pack(std::make_index_sequence<TDimensions>(), ids...);
+        }
+        else
+        {
+            return _grid_to_list_id_index(ids...);
+        }
+    }
+
+    //! grid position of the value at data()[lid]; lid must not address padding
+    [[nodiscard]] grid_id_type
+    list_to_grid_id(size_type lid) const
+    {
+        assert(lid < _values.size());
+
+        size_type brick = lid >> shape::volume_shift;
+        size_type inner = lid & (shape::volume - 1);
+
+        grid_id_type gid{};
+
+        for (size_type k = 0; k < TDimensions; ++k)
+        {
+            const size_type b = brick / _brick_strides[k];
+            brick -= b * _brick_strides[k];
+
+            gid[k] = (b << shape::shifts[k]) + ((inner >> shape::inner_shifts[k]) & (shape::sizes[k] - 1));
+        }
+
+        return gid;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // access
+    //------------------------------------------------------------------------------------------------------
+    template<typename... Ids>
+    [[nodiscard]] bool
+    is_valid_ids(const Ids& ... ids) const
+    {
+        if constexpr (sizeof...(Ids) == TDimensions)
+        {
+            size_type k = 0;
+            return ((ids >= 0 && static_cast<size_type>(ids) < _sizes[k++]) && ...);
+        }
+        else
+        {
+            static_assert(sizeof...(Ids) == 1, "provide either N individual integral indices or an index[]-accessible object");
+
+            const auto& gid = std::get<0>(std::forward_as_tuple(ids...));
+
+            for (size_type k = 0; k < TDimensions; ++k)
+            {
+                if (gid[k] < 0 || static_cast<size_type>(gid[k]) >= _sizes[k])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] reference
+    operator()(const Ids& ... ids)
+    {
+        assert(is_valid_ids(ids...));
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] const_reference
+    operator()(const Ids& ... ids) const
+    {
+        assert(is_valid_ids(ids...));
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] reference
+    at_grid(const Ids& ... ids)
+    {
+        if (!is_valid_ids(ids...))
+        {
+            throw std::out_of_range("invalid tiled_grid access!");
+        }
+
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    template<typename... Ids>
+    [[nodiscard]] const_reference
+    at_grid(const Ids& ... ids) const
+    {
+        if (!is_valid_ids(ids...))
+        {
+            throw std::out_of_range("invalid tiled_grid access!");
+        }
+
+        return _values[grid_to_list_id(ids...)];
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // iterators
+    //------------------------------------------------------------------------------------------------------
+    [[nodiscard]] iterator
+    begin() noexcept
+    {
+        return empty() ? end() : iterator(this, 0);
+    }
+
+    [[nodiscard]] const_iterator
+    begin() const noexcept
+    {
+        return empty() ? end() : const_iterator(this, 0);
+    }
+
+    [[nodiscard]] iterator
+    end() noexcept
+    {
+        return iterator(this, static_cast<size_type>(_values.size()));
+    }
+
+    [[nodiscard]] const_iterator
+    end() const noexcept
+    {
+        return const_iterator(this, static_cast<size_type>(_values.size()));
+    }
+
+    //====================================================================================================
+    //===== SETTER
+    //====================================================================================================
+    template<typename T>
+    void
+    resize(std::initializer_list<T> sizes, const value_type& defaultInitValue)
+    {
+        assert(sizes.size() == num_dimensions() && "invalid number or sizes in initializer list");
+        resize(sizes.begin(), sizes.end(), defaultInitValue);
+    }
+
+    //! sets new sizes; all values (incl. padding) are set to defaultInitValue
+    template<typename TForwardIterator, std::enable_if_t<!std::is_arithmetic_v<std::decay_t<TForwardIterator>>>* = nullptr>
+    void
+    resize(TForwardIterator first, TForwardIterator last, const value_type& defaultInitValue)
+    {
+        std::copy(first, last, _sizes.begin());
+        assert(std::all_of(_sizes.begin(), _sizes.end(), [](size_type x)
+        {
+            return x > 0;
+        }) && "all sizes must be > 0");
+
+        size_type numBricksTotal = 1;
+
+        for (size_type k = TDimensions; k-- > 0;)
+        {
+            _num_bricks[k]    = (_sizes[k] + brick_size(k) - 1) >> shape::shifts[k];
+            _brick_strides[k] = numBricksTotal;
+            numBricksTotal *= _num_bricks[k];
+        }
+
+        _values.assign(static_cast<std::size_t>(numBricksTotal) << shape::volume_shift, defaultInitValue);
+        _values.shrink_to_fit();
+    }
+
+    void
+    clear()
+    {
+        _sizes.fill(0);
+        _num_bricks.fill(0);
+        _brick_strides.fill(0);
+        _values.clear();
+    }
+
+    void
+    fill(const_reference value)
+    {
+        std::fill(_values.begin(), _values.end(), value);
+    }
+
+    void
+    swap(self_type& other) noexcept
+    {
+        std::swap(_sizes, other._sizes);
+        std::swap(_num_bricks, other._num_bricks);
+        std::swap(_brick_strides, other._brick_strides);
+        std::swap(_values, other._values);
+    }
+}; // class tiled_grid
+} // namespace nd
+
+#endif //__ND_TILED_GRID_H__m3n7b1v5c9x2z6l4k8j0h3g7f1d5s9
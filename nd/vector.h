@@ -37,10 +37,20 @@
 #include <numeric>
 #include <ostream>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "charconv.h"
+#include "convert.h"
+#include "fast_divisor.h"
+#include "grid_view.h"
+#include "layout.h"
+#include "mdspan.h"
+#include "small_vector.h"
+
 #if !defined(__GNUC__) || defined(__MINGW32__)
   #define ND_FORCE_INLINE __forceinline
 #else // IF __GNUC__
@@ -49,14 +59,23 @@
 
 namespace nd
 {
-template<typename TValue>
+template<typename TValue, std::size_t TDimensions, layout TLayout>
+class grid;
+
+template<typename TValue, layout TLayout = layout::last_axis_contiguous>
 class vector
 {
     //------------------------------------------------------------------------------------------------------
     // definitions
     //------------------------------------------------------------------------------------------------------
   public:
-    using self_type = vector<TValue>;
+    [[nodiscard]] ND_FORCE_INLINE static constexpr layout
+    memory_layout() noexcept
+    {
+        return TLayout;
+    }
+
+    using self_type = vector<TValue, TLayout>;
     using value_type = TValue;
     using data_container_type = std::vector<value_type>;
     using size_type = unsigned int;
@@ -69,14 +88,18 @@ class vector
     using const_iterator = typename data_container_type::const_iterator;
     using reverse_iterator = typename data_container_type::reverse_iterator;
     using const_reverse_iterator = typename data_container_type::const_reverse_iterator;
+    //! per-dimension sizes / strides; stored inside the vector up to 8 dimensions
+    using shape_type = small_vector<size_type, 8>;
 
     //------------------------------------------------------------------------------------------------------
     // members
     //------------------------------------------------------------------------------------------------------
   private:
-    std::vector<size_type> _sizes;
-    std::vector<size_type> _strides;
-    data_container_type    _values;
+    shape_type                    _sizes;
+    shape_type                    _strides;
+    //! _strides as multiply / shift divisors for list_to_grid_id()
+    small_vector<fast_divisor, 8> _divisors;
+    data_container_type           _values;
 
     //------------------------------------------------------------------------------------------------------
     // class
@@ -90,12 +113,50 @@ class vector
 
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     ND_FORCE_INLINE
-    vector(const vector<K>& other) :
+    vector(const vector<K, TLayout>& other) :
         _sizes(other.size())
         , _strides(other.strides())
-        , _values(other.data().begin(), other.data().end())
+        , _divisors()
+        , _values(other.num_values())
+    {
+        static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
+        _calc_divisors();
+        detail::convert_values(other.data(), _values);
+    }
+
+    //! copies a vector with the other memory layout; values are reordered so that (i, j, ...) stays the same element
+    template<typename K, layout TOtherLayout, std::enable_if_t<TOtherLayout != TLayout>* = nullptr>
+    explicit vector(const vector<K, TOtherLayout>& other) :
+        _sizes(other.size())
+        , _strides()
+        , _values(other.num_values())
     {
         static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
+
+        _calc_strides();
+
+        // walk this vector in list order and advance the list id of the other vector along with the grid id
+        std::vector<size_type> gid(num_dimensions(), 0);
+        size_type              otherLid = 0;
+
+        for (size_type i = 0; i < num_values(); ++i)
+        {
+            _values[i] = static_cast<value_type>(other[otherLid]);
+
+            for (size_type k = num_dimensions(); k-- > 0;)
+            {
+                const size_type d = _dim_by_stride(k);
+
+                if (++gid[d] < size(d))
+                {
+                    otherLid += other.stride(d);
+                    break;
+                }
+
+                otherLid -= (size(d) - 1) * other.stride(d);
+                gid[d] = 0;
+            }
+        }
     }
 
     template<typename... TSizes, std::enable_if_t<std::conjunction_v<std::is_arithmetic<std::decay_t<TSizes>>...> && std::is_arithmetic_v<value_type>>* = nullptr>
@@ -134,6 +195,37 @@ class vector
         _calc_strides();
     }
 
+    //! takes over the values of an nd::grid< T, N > with the same layout without copying; other is left empty
+    template<std::size_t TDimensions>
+    explicit vector(grid<value_type, TDimensions, TLayout>&& other) :
+        _sizes(other.size().begin(), other.size().end())
+        , _strides()
+        , _values(other.release())
+    {
+        _calc_strides();
+    }
+
+    //! wraps existing values (in list order of TLayout) as a vector without copying
+    /*!
+     * throws std::invalid_argument if values.size() does not match the product of sizes
+     */
+    [[nodiscard]] static self_type
+    from_vector(data_container_type&& values, const std::vector<size_type>& sizes)
+    {
+        self_type v;
+        v._sizes.assign(sizes.begin(), sizes.end());
+
+        if (v.num_values_from_sizes() != values.size())
+        {
+            throw std::invalid_argument("from_vector: " + std::to_string(values.size()) + " values do not match sizes with " + std::to_string(v.num_values_from_sizes()) + " values");
+        }
+
+        v._values = std::move(values);
+        v._calc_strides();
+
+        return v;
+    }
+
     ND_FORCE_INLINE ~vector() = default;
 
     [[maybe_unused]] ND_FORCE_INLINE self_type&
@@ -144,15 +236,16 @@ class vector
 
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     [[maybe_unused]] ND_FORCE_INLINE self_type&
-    operator=(const vector<K>& other)
+    operator=(const vector<K, TLayout>& other)
     {
         static_assert(std::is_convertible_v<K, value_type>, "cannot cast types");
 
         _sizes   = other.size();
         _strides = other.strides();
+        _calc_divisors();
 
         _values.resize(other.num_values());
-        std::copy(other.data().begin(), other.data().end(), _values.begin());
+        detail::convert_values(other.data(), _values);
 
         return *this;
     }
@@ -161,33 +254,54 @@ class vector
     // cast
     //------------------------------------------------------------------------------------------------------
     template<typename T>
-    [[nodiscard]] ND_FORCE_INLINE vector<T>
+    [[nodiscard]] ND_FORCE_INLINE vector<T, TLayout>
     cast() const
     {
         static_assert(std::is_convertible_v<value_type, T>, "cannot cast types");
-        return vector<T>(*this);
+        return vector<T, TLayout>(*this);
     }
 
     //------------------------------------------------------------------------------------------------------
     // stride
     //------------------------------------------------------------------------------------------------------
   private:
+    //! dimension with the k-th largest stride
+    [[nodiscard]] ND_FORCE_INLINE size_type
+    _dim_by_stride(size_type k) const noexcept
+    {
+        return TLayout == layout::last_axis_contiguous ? k : num_dimensions() - 1 - k;
+    }
+
     void
     _calc_strides()
     {
         _strides.resize(_sizes.size());
 
-        for (size_type i = 0; i < num_dimensions(); ++i)
+        size_type s = 1U;
+
+        for (size_type k = num_dimensions(); k-- > 0;)
         {
-            _strides[i] = 1U;
+            const size_type d = _dim_by_stride(k);
 
-            for (size_type k = i + 1; k < num_dimensions(); ++k)
-            {
-                _strides[i] *= _sizes[k];
-            }
+            _strides[d] = s;
+            s *= _sizes[d];
         }
 
         _strides.shrink_to_fit();
+        _calc_divisors();
+    }
+
+    void
+    _calc_divisors()
+    {
+        _divisors.resize(_strides.size());
+
+        for (size_type d = 0; d < num_dimensions(); ++d)
+        {
+            _divisors[d] = fast_divisor(_strides[d]);
+        }
+
+        _divisors.shrink_to_fit();
     }
 
   public:
@@ -198,7 +312,7 @@ class vector
         return _strides[dimId];
     }
 
-    [[nodiscard]] ND_FORCE_INLINE const std::vector<size_type>&
+    [[nodiscard]] ND_FORCE_INLINE const shape_type&
     strides() const
     {
         return _strides;
@@ -213,7 +327,7 @@ class vector
         return _sizes.size();
     }
 
-    [[nodiscard]] ND_FORCE_INLINE const std::vector<size_type>&
+    [[nodiscard]] ND_FORCE_INLINE const shape_type&
     size() const
     {
         return _sizes;
@@ -242,29 +356,31 @@ class vector
 
         std::vector<size_type> gid(num_dimensions());
 
-        const auto str = strides();
-
-        for (size_type i = 0; i < num_dimensions() - 1; ++i)
+        // divide by the strides from largest to smallest; the contiguous dimension gets the remainder
+        for (size_type k = 0; k < num_dimensions() - 1; ++k)
         {
-            gid[i] = lid;
-
-            for (size_type k = 0; k < i; ++k)
-            {
-                gid[i] -= str[k] * gid[k];
-            }
+            const size_type d = _dim_by_stride(k);
 
-            gid[i] /= str[i];
+            gid[d] = _divisors[d].divide(lid);
+            lid -= gid[d] * _strides[d];
         }
 
-        gid[num_dimensions() - 1] = lid;
-        for (size_type i = 0; i < num_dimensions() - 1; ++i)
-        {
-            gid[num_dimensions() - 1] -= str[i] * gid[i];
-        }
+        gid[_dim_by_stride(num_dimensions() - 1)] = lid;
 
         return gid;
     }
 
+    //! list_to_grid_id() for each list id in [first, last); writes num_dimensions() coordinates per id to out
+    /*!
+     * converts blocks of ids one dimension at a time, which vectorizes better than single conversions
+     */
+    template<typename TInputIterator, typename TOutputIterator>
+    TOutputIterator
+    list_to_grid_ids(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+        return detail::list_to_grid_ids(first, last, out, num_dimensions(), _strides.data(), _divisors.data(), TLayout == layout::last_axis_contiguous);
+    }
+
   private:
     template<typename TIndexAccessible>
     [[nodiscard]] ND_FORCE_INLINE size_type
@@ -346,6 +462,125 @@ class vector
         return std::move(_values);
     }
 
+    //! moves the values out without copying; the vector is left empty
+    [[nodiscard]] data_container_type
+    release() noexcept
+    {
+        data_container_type values = std::move(_values);
+        clear();
+
+        return values;
+    }
+
+    //------------------------------------------------------------------------------------------------------
+    // span / mdspan
+    //------------------------------------------------------------------------------------------------------
+    template<std::size_t N>
+    using mdspan_type = mdspan<value_type, dextents<N>, detail::mdspan_layout_t<TLayout>>;
+    template<std::size_t N>
+    using const_mdspan_type = mdspan<const value_type, dextents<N>, detail::mdspan_layout_t<TLayout>>;
+
+    //! zero-copy view of all values in list order
+    [[nodiscard]] span<value_type>
+    as_span() noexcept
+    {
+        return span<value_type>(_values.data(), _values.size());
+    }
+
+    [[nodiscard]] span<const value_type>
+    as_span() const noexcept
+    {
+        return span<const value_type>(_values.data(), _values.size());
+    }
+
+    //! zero-copy view of rank N; invalidated by resizing
+    /*!
+     * throws std::invalid_argument if N != num_dimensions()
+     */
+    template<std::size_t N>
+    [[nodiscard]] mdspan_type<N>
+    as_mdspan()
+    {
+        return _as_mdspan<mdspan_type<N>>(_values.data(), std::make_index_sequence<N>());
+    }
+
+    template<std::size_t N>
+    [[nodiscard]] const_mdspan_type<N>
+    as_mdspan() const
+    {
+        return _as_mdspan<const_mdspan_type<N>>(_values.data(), std::make_index_sequence<N>());
+    }
+
+  private:
+    template<typename TMdspan, typename TPointer, std::size_t... Is>
+    [[nodiscard]] TMdspan
+    _as_mdspan(TPointer data, std::index_sequence<Is...>) const
+    {
+        if (num_dimensions() != sizeof...(Is))
+        {
+            throw std::invalid_argument("as_mdspan: rank " + std::to_string(sizeof...(Is)) + " requested, vector has " + std::to_string(num_dimensions()) + " dimensions");
+        }
+
+        return TMdspan(data, _sizes[Is]...);
+    }
+
+  public:
+
+    //------------------------------------------------------------------------------------------------------
+    // fixed-rank dispatch
+    //------------------------------------------------------------------------------------------------------
+    //! max num_dimensions() supported by visit()
+    static constexpr std::size_t max_visit_dimensions = 8;
+
+    //! calls f(grid_view< T, N >) with N = num_dimensions(); dispatches once, all accesses inside f use N strides
+    /*!
+     * f must return the same type for every N in [1, max_visit_dimensions]
+     * throws std::invalid_argument if num_dimensions() is 0 or exceeds max_visit_dimensions
+     */
+    template<typename TFunction>
+    decltype(auto)
+    visit(TFunction&& f)
+    {
+        return _visit<1>(_values.data(), f);
+    }
+
+    template<typename TFunction>
+    decltype(auto)
+    visit(TFunction&& f) const
+    {
+        return _visit<1>(_values.data(), f);
+    }
+
+  private:
+    template<std::size_t N, typename TPointer, typename TFunction>
+    decltype(auto)
+    _visit(TPointer data, TFunction& f) const
+    {
+        if (num_dimensions() == N)
+        {
+            using view_type = grid_view<std::remove_pointer_t<TPointer>, N>;
+
+            typename view_type::grid_id_type sizes;
+            typename view_type::grid_id_type strides;
+
+            std::copy(_sizes.begin(), _sizes.end(), sizes.begin());
+            std::copy(_strides.begin(), _strides.end(), strides.begin());
+
+            return f(view_type(data, sizes, strides, TLayout));
+        }
+
+        if constexpr (N < max_visit_dimensions)
+        {
+            return _visit<N + 1>(data, f);
+        }
+        else
+        {
+            throw std::invalid_argument("visit: " + std::to_string(num_dimensions()) + " dimensions, supported are 1 to " + std::to_string(max_visit_dimensions));
+        }
+    }
+
+  public:
+
     //------------------------------------------------------------------------------------------------------
     // num values
     //------------------------------------------------------------------------------------------------------
@@ -692,6 +927,7 @@ class vector
         _values.clear();
         _sizes.clear();
         _strides.clear();
+        _divisors.clear();
     }
 
     void
@@ -699,6 +935,7 @@ class vector
     {
         _sizes.shrink_to_fit();
         _strides.shrink_to_fit();
+        _divisors.shrink_to_fit();
         _values.shrink_to_fit();
     }
 
@@ -714,6 +951,78 @@ class vector
         _values.reserve(size0 * (sizes * ... * 1U));
     }
 
+    //------------------------------------------------------------------------------------------------------
+    // append slice
+    //------------------------------------------------------------------------------------------------------
+    //! appends a slice of size (size(1), ..., size(N-1)) at the end of dimension 0
+    /*!
+     * - with layout::first_axis_contiguous, the slice has size (size(0), ..., size(N-2)) and is appended at the end of dimension N-1
+     * - the slice is any container with size() and begin() / end() in list order, e.g., nd::vector< T > or nd::grid< T, N-1 > with the same layout
+     * - if the vector is empty, the slice defines the number of dimensions and the sizes of the remaining dimensions
+     * - existing values are kept; the storage grows with amortized capacity.
+     *   Use reserve(expectedNumSlices, sizes of a slice...) to avoid reallocations entirely
+     * - throws std::invalid_argument if the slice sizes do not match
+     */
+    template<typename TSlice, std::enable_if_t<std::is_class_v<TSlice>>* = nullptr>
+    void
+    append_slice(const TSlice& slice)
+    {
+        const auto& sliceSizes = slice.size();
+
+        if constexpr (detail::layout_of<TSlice>::known && detail::layout_of<TSlice>::value != TLayout)
+        {
+            if (sliceSizes.size() > 1)
+            {
+                throw std::invalid_argument("append_slice: the slice must have the same memory layout");
+            }
+        }
+
+        if (sliceSizes.size() == 0 || std::any_of(sliceSizes.begin(), sliceSizes.end(), [](auto x){return x == 0;}))
+        {
+            throw std::invalid_argument("append_slice: invalid slice sizes");
+        }
+
+        if (empty())
+        {
+            _sizes.resize(sliceSizes.size() + 1);
+        }
+        else if (sliceSizes.size() + 1 != num_dimensions())
+        {
+            throw std::invalid_argument("append_slice: slice sizes do not match");
+        }
+
+        const size_type outerDim = _dim_by_stride(0);
+        const size_type firstDim = outerDim == 0 ? 1 : 0;
+
+        if (empty())
+        {
+            _sizes[outerDim] = 0;
+            std::copy(sliceSizes.begin(), sliceSizes.end(), _sizes.begin() + firstDim);
+            _calc_strides();
+        }
+        else if (!std::equal(sliceSizes.begin(), sliceSizes.end(), _sizes.begin() + firstDim))
+        {
+            throw std::invalid_argument("append_slice: slice sizes do not match");
+        }
+
+        _values.insert(_values.end(), slice.begin(), slice.end());
+        ++_sizes[outerDim];
+    }
+
+    //! appends the values [first, last) of a slice in list order; the vector must not be empty
+    template<typename TForwardIterator>
+    void
+    append_slice(TForwardIterator first, TForwardIterator last)
+    {
+        if (empty() || num_dimensions() < 2 || static_cast<std::size_t>(std::distance(first, last)) != stride(_dim_by_stride(0)))
+        {
+            throw std::invalid_argument("append_slice: number of values does not match the slice size");
+        }
+
+        _values.insert(_values.end(), first, last);
+        ++_sizes[_dim_by_stride(0)];
+    }
+
     //------------------------------------------------------------------------------------------------------
     // set values
     //------------------------------------------------------------------------------------------------------
@@ -739,13 +1048,14 @@ class vector
     //------------------------------------------------------------------------------------------------------
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     void
-    swap(vector<K>& other) noexcept
+    swap(vector<K, TLayout>& other) noexcept
     {
         _sizes.resize(other.num_dimensions());
         std::copy(other.size().begin(), other.size().end(), _sizes.begin());
 
         _strides.resize(other.num_dimensions());
         std::copy(other.strides().begin(), other.strides().end(), _strides.begin());
+        _calc_divisors();
 
         _values.resize(num_values());
         for (size_type i = 0; i < num_values(); ++i)
@@ -758,13 +1068,14 @@ class vector
 
     template<typename K, std::enable_if_t<!std::is_same_v<K, value_type>>* = nullptr>
     void
-    swap(vector<K>&& other) noexcept
+    swap(vector<K, TLayout>&& other) noexcept
     {
         _sizes.resize(other.num_dimensions());
         std::copy(other.size().begin(), other.size().end(), _sizes.begin());
 
         _strides.resize(other.num_dimensions());
         std::copy(other.strides().begin(), other.strides().end(), _strides.begin());
+        _calc_divisors();
 
         _values.resize(num_values());
         for (size_type i = 0; i < num_values(); ++i)
@@ -778,6 +1089,7 @@ class vector
     {
         std::swap(_sizes, other._sizes);
         std::swap(_strides, other._strides);
+        std::swap(_divisors, other._divisors);
         std::swap(_values, other._values);
     }
 
@@ -785,8 +1097,9 @@ class vector
     swap(self_type&& other)
     {
         _sizes   = std::move(other._sizes);
-        _strides = std::move(other._strides);
-        _values  = std::move(other._values);
+        _strides  = std::move(other._strides);
+        _divisors = std::move(other._divisors);
+        _values   = std::move(other._values);
     }
 
     //------------------------------------------------------------------------------------------------------
@@ -795,7 +1108,7 @@ class vector
   private:
     template<typename K>
     [[nodiscard]] bool
-    _sizes_match(const vector<K>& other) const
+    _sizes_match(const vector<K, TLayout>& other) const
     {
         if (num_dimensions() != other.num_dimensions())
         {
@@ -820,7 +1133,7 @@ class vector
     //------------------------------------------------------------------------------------------------------
     template<typename K>
     [[nodiscard]] bool
-    _compare_data_vectors(const vector<K>& other, std::function<bool(const_reference, typename vector<K>::const_reference)> comp) const
+    _compare_data_vectors(const vector<K, TLayout>& other, std::function<bool(const_reference, typename vector<K, TLayout>::const_reference)> comp) const
     {
         if (!_sizes_match(other))
         {
@@ -839,7 +1152,7 @@ class vector
 
     template<typename K>
     [[nodiscard]] bool
-    operator==(const vector<K>& other) const
+    operator==(const vector<K, TLayout>& other) const
     {
         if constexpr (!std::is_convertible_v<value_type, K> || !std::is_convertible_v<K, value_type>)
         {
@@ -847,7 +1160,7 @@ class vector
         }
         else
         {
-            constexpr auto comp = [](const_reference x, typename vector<K>::const_reference y) -> bool
+            constexpr auto comp = [](const_reference x, typename vector<K, TLayout>::const_reference y) -> bool
             {
                 return x == y;
             };
@@ -858,7 +1171,7 @@ class vector
 
     template<typename K>
     [[nodiscard]] bool
-    operator<(const vector<K>& other) const
+    operator<(const vector<K, TLayout>& other) const
     {
         static_assert(std::is_convertible_v<value_type, K> && std::is_convertible_v<K, value_type>);
 
@@ -867,7 +1180,7 @@ class vector
             return num_values() < other.num_values();
         }
 
-        constexpr auto comp = [](const_reference x, typename vector<K>::const_reference y) -> bool
+        constexpr auto comp = [](const_reference x, typename vector<K, TLayout>::const_reference y) -> bool
         {
             return x < y;
         };
@@ -877,28 +1190,28 @@ class vector
 
     template<typename K>
     [[nodiscard]] ND_FORCE_INLINE bool
-    operator!=(const vector<K>& other) const
+    operator!=(const vector<K, TLayout>& other) const
     {
         return !operator==(other);
     }
 
     template<typename K>
     [[nodiscard]] ND_FORCE_INLINE bool
-    operator<=(const vector<K>& other) const
+    operator<=(const vector<K, TLayout>& other) const
     {
         return operator<(other) || operator==(other);
     }
 
     template<typename K>
     [[nodiscard]] ND_FORCE_INLINE bool
-    operator>(const vector<K>& other) const
+    operator>(const vector<K, TLayout>& other) const
     {
         return !operator<=(other);
     }
 
     template<typename K>
     [[nodiscard]] ND_FORCE_INLINE bool
-    operator>=(const vector<K>& other) const
+    operator>=(const vector<K, TLayout>& other) const
     {
         return !operator<(other);
     }
@@ -906,90 +1219,189 @@ class vector
     //------------------------------------------------------------------------------------------------------
     // to string
     //------------------------------------------------------------------------------------------------------
-    [[nodiscard]] std::string
-    to_string() const
+  private:
+    [[nodiscard]] std::size_t
+    _estimated_string_length() const noexcept
     {
-        std::stringstream s;
+        // rough guess per value incl. separator; 3D+ additionally prints the grid id of each value
+        constexpr std::size_t charsPerValue = std::is_floating_point_v<value_type> ? 12U : 6U;
+        const std::size_t     charsPerId    = num_dimensions() > 2 ? 4U * num_dimensions() + 3U : 0U;
+
+        return 2U + num_values() * (charsPerValue + charsPerId);
+    }
+
+    void
+    _format(std::string& s) const
+    {
+        s += '[';
 
         if (num_dimensions() == 1)
         {
-            s << "[";
-
             for (size_type i = 0; i < num_values(); ++i)
             {
-                s << operator[](i);
-
-                if (i < num_values() - 1)
+                if (i != 0)
                 {
-                    s << ", ";
+                    s += ", ";
                 }
-            }
 
-            s << "]";
+                detail::append_value(s, _values[i]);
+            }
         }
         else if (num_dimensions() == 2)
         {
-            s << "[";
-
+            // each printed row contains the values along dimension 0
             for (size_type y = 0; y < size(1); ++y)
             {
                 if (y != 0)
                 {
-                    s << " ";
+                    s += "\n ";
                 }
 
-                s << "[";
+                s += '[';
 
-                for (size_type x = 0; x < size(0); ++x)
+                size_type lid = y * stride(1);
+                for (size_type x = 0; x < size(0); ++x, lid += stride(0))
                 {
-                    s << at_grid(x, y);
-
-                    if (x < size(0) - 1)
+                    if (x != 0)
                     {
-                        s << ", ";
+                        s += ", ";
                     }
-                }
 
-                s << "]";
-
-                if (y < size(1) - 1)
-                {
-                    s << "\n";
+                    detail::append_value(s, _values[lid]);
                 }
-            }
 
-            s << "]";
+                s += ']';
+            }
         }
         else
         {
-            s << "[";
+            // values are printed with the last dimension running fastest regardless of the memory layout;
+            // the list id is advanced along with the grid id instead of being recomputed via grid_to_list_id()
+            std::vector<size_type> gid(num_dimensions(), 0);
+            size_type              lid = 0;
 
             for (size_type i = 0; i < num_values(); ++i)
             {
-                const auto gid = list_to_grid_id(i);
-                s << "(";
-                for (size_type k = 0; k < gid.size(); ++k)
+                if (i != 0)
+                {
+                    s += ", ";
+                }
+
+                s += '(';
+                for (size_type k = 0; k < num_dimensions(); ++k)
                 {
-                    s << gid[k];
-                    if (k < gid.size() - 1)
+                    if (k != 0)
                     {
-                        s << ",";
+                        s += ',';
                     }
+
+                    detail::append_index(s, gid[k]);
                 }
-                s << ")=";
+                s += ")=";
 
-                s << operator[](i);
+                detail::append_value(s, _values[lid]);
 
-                if (i < num_values() - 1)
+                for (size_type k = num_dimensions(); k-- > 0;)
                 {
-                    s << ", ";
+                    if (++gid[k] < size(k))
+                    {
+                        lid += stride(k);
+                        break;
+                    }
+
+                    lid -= (size(k) - 1) * stride(k);
+                    gid[k] = 0;
                 }
             }
+        }
+
+        s += ']';
+    }
+
+  public:
+
+    [[nodiscard]] std::string
+    to_string() const
+    {
+        std::string s;
+        s.reserve(_estimated_string_length());
+        _format(s);
+        return s;
+    }
+
+    //! writes to_string() to an output iterator, e.g., std::ostreambuf_iterator<char> or std::back_inserter
+    template<typename TOutputIterator>
+    TOutputIterator
+    format_to(TOutputIterator out) const
+    {
+        const std::string s = to_string();
+        return std::copy(s.begin(), s.end(), out);
+    }
 
-            s << "]";
+    //------------------------------------------------------------------------------------------------------
+    // from string
+    //------------------------------------------------------------------------------------------------------
+  public:
+    //! inverse of to_string()
+    [[nodiscard]] static self_type
+    from_string(std::string_view str)
+    {
+        std::vector<size_type>  sizes;
+        std::vector<value_type> values;
+        detail::parse_string(str, sizes, values);
+
+        self_type res;
+
+        if (values.empty())
+        {
+            return res;
         }
 
-        return s.str();
+        res._sizes.assign(sizes.begin(), sizes.end());
+        res._calc_strides();
+
+        if (res.num_dimensions() == 2)
+        {
+            res._values.resize(values.size());
+
+            for (size_type y = 0, t = 0; y < res.size(1); ++y)
+            {
+                for (size_type x = 0; x < res.size(0); ++x)
+                {
+                    res._values[x * res.stride(0) + y * res.stride(1)] = values[t++];
+                }
+            }
+        }
+        else if (TLayout == layout::last_axis_contiguous)
+        {
+            res._values = std::move(values);
+        }
+        else
+        {
+            res._values.resize(values.size());
+
+            std::vector<size_type> gid(res.num_dimensions(), 0);
+            size_type              lid = 0;
+
+            for (size_type t = 0; t < values.size(); ++t)
+            {
+                res._values[lid] = values[t];
+
+                for (size_type k = res.num_dimensions(); k-- > 0;)
+                {
+                    if (++gid[k] < res.size(k))
+                    {
+                        lid += res.stride(k);
+                        break;
+                    }
+
+                    lid -= (res.size(k) - 1) * res.stride(k);
+                    gid[k] = 0;
+                }
+            }
+        }
+
+        return res;
     }
 }; // class vector
 } // namespace nd
@@ -997,9 +1409,9 @@ class vector
 //------------------------------------------------------------------------------------------------------
 // external stream operator
 //------------------------------------------------------------------------------------------------------
-template<typename T>
+template<typename T, nd::layout L>
 [[maybe_unused]] std::ostream&
-operator<<(std::ostream& o, const nd::vector<T>& v)
+operator<<(std::ostream& o, const nd::vector<T, L>& v)
 {
     o << v.to_string();
     return o;
@@ -1008,25 +1420,33 @@ operator<<(std::ostream& o, const nd::vector<T>& v)
 //------------------------------------------------------------------------------------------------------
 // external swap
 //------------------------------------------------------------------------------------------------------
-template<typename T, typename K>
+template<typename T, typename K, nd::layout L>
 ND_FORCE_INLINE inline void
-swap(nd::vector<T>& a, nd::vector<K>& b) noexcept
+swap(nd::vector<T, L>& a, nd::vector<K, L>& b) noexcept
 {
     a.swap(b);
 }
 
-template<typename T, typename K>
+template<typename T, typename K, nd::layout L>
 ND_FORCE_INLINE inline void
-swap(nd::vector<T>&& a, nd::vector<K>& b) noexcept
+swap(nd::vector<T, L>&& a, nd::vector<K, L>& b) noexcept
 {
     b.swap(std::move(a));
 }
 
-template<typename T, typename K>
+template<typename T, typename K, nd::layout L>
 ND_FORCE_INLINE inline void
-swap(nd::vector<T>& a, nd::vector<K>&& b) noexcept
+swap(nd::vector<T, L>& a, nd::vector<K, L>&& b) noexcept
 {
     a.swap(std::move(b));
 }
 
+//------------------------------------------------------------------------------------------------------
+// precompiled instantiations (bk::ndcontainer_precompiled)
+//------------------------------------------------------------------------------------------------------
+#ifdef ND_PRECOMPILED
+  #include "precompiled.h"
+ND_PRECOMPILED_VECTOR_INSTANTIATIONS(extern)
+#endif
+
 #endif //__ND_VECTOR_H__8945u23895cuifnui34nf892348923m98r
\ No newline at end of file
@@ -22,6 +22,8 @@
  * SOFTWARE.
  */
 
+#include <cstring>
+
 #include "common.h"
 #include "nd/array.h"
 
@@ -82,3 +84,66 @@ TEST(nd_array, ctor)
         EXPECT_EQ(a[4], b[4]);
     }
 }
+
+TEST(nd_array, ctor_uninitialized)
+{
+    {
+        nd::array<float, 3, 3> a(nd::uninitialized);
+        a.fill(2.5f);
+
+        for (auto x : a)
+        { EXPECT_EQ(x, 2.5f); }
+    }
+    {
+        // class types are still default constructed
+        nd::array<std::string, 2> a(nd::uninitialized);
+        EXPECT_TRUE(a[0].empty());
+        EXPECT_TRUE(a[1].empty());
+    }
+    {
+        nd::basic_array<int, nd::layout::first_axis_contiguous, 2, 3> a(nd::uninitialized);
+        std::iota(a.begin(), a.end(), 0);
+        EXPECT_EQ(a(1, 2), 5);
+    }
+}
+
+TEST(nd_array, ctor_trivially_copyable)
+{
+    static_assert(std::is_trivially_copyable_v<nd::array<float, 3, 3>>);
+    static_assert(std::is_trivially_copyable_v<nd::array<unsigned char, 1>>);
+    static_assert(std::is_trivially_copyable_v<nd::basic_array<double, nd::layout::first_axis_contiguous, 2, 4, 3>>);
+    static_assert(std::is_standard_layout_v<nd::array<float, 3, 3>>);
+    static_assert(sizeof(nd::array<float, 3, 3>) == 9 * sizeof(float));
+    static_assert(!std::is_trivially_copyable_v<nd::array<std::string, 2>>);
+    static_assert(std::is_nothrow_move_constructible_v<nd::array<std::string, 2>>);
+
+    // defaulted copy / move stay constexpr
+    {
+        constexpr nd::array<int, 2, 2> a(1, 2, 3, 4);
+        constexpr nd::array<int, 2, 2> b = a;
+        constexpr nd::array<int, 2, 2> c = std::move(nd::array<int, 2, 2>(5, 6, 7, 8));
+        static_assert(b[3] == 4);
+        static_assert(c[0] == 5);
+    }
+    {
+        const nd::array<float, 2, 3> a(1.f, 2.f, 3.f, 4.f, 5.f, 6.f);
+        nd::array<float, 2, 3>       b(nd::uninitialized);
+        std::memcpy(static_cast<void*>(&b), &a, sizeof(a));
+        EXPECT_EQ(a, b);
+    }
+    {
+        std::vector<nd::array<double, 3>> v(1000, nd::array<double, 3>(1.0, 2.0, 3.0));
+        v.resize(5000);
+        const std::vector<nd::array<double, 3>> w = v;
+        EXPECT_EQ(w.size(), 5000);
+        EXPECT_EQ(w[999], (nd::array<double, 3>(1.0, 2.0, 3.0)));
+        EXPECT_EQ(w[1000], (nd::array<double, 3>()));
+    }
+    {
+        const nd::array<std::string, 2> a("x", "yz");
+        nd::array<std::string, 2>       b(a);
+        const nd::array<std::string, 2> c(std::move(b));
+        EXPECT_EQ(c[1], "yz");
+        EXPECT_EQ(a[1], "yz");
+    }
+}
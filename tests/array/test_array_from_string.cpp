@@ -0,0 +1,49 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/array.h"
+
+TEST(nd_array, from_string)
+{
+    {
+        constexpr nd::array<int, 4> a(1, -2, 3, 4);
+        EXPECT_EQ(a.to_string(), "[1, -2, 3, 4]");
+        EXPECT_EQ((nd::array<int, 4>::from_string(a.to_string())), a);
+    }
+    {
+        constexpr nd::array<int, 2, 4> a(1, 2, 3, 4, 5, 6, 7, 8);
+        EXPECT_EQ(a.to_string(), "[[1, 5]\n [2, 6]\n [3, 7]\n [4, 8]]");
+        EXPECT_EQ((nd::array<int, 2, 4>::from_string(a.to_string())), a);
+    }
+    {
+        constexpr nd::array<double, 2, 2, 2> a(0.5, 1.25, -3.0, 4.0, 1e-9, 6.0, 7.0, 8.0);
+        EXPECT_EQ(a.to_string(), "[(0,0,0)=0.5, (0,0,1)=1.25, (0,1,0)=-3, (0,1,1)=4, (1,0,0)=1e-09, (1,0,1)=6, (1,1,0)=7, (1,1,1)=8]");
+        EXPECT_EQ((nd::array<double, 2, 2, 2>::from_string(a.to_string())), a);
+    }
+    {
+        EXPECT_THROW(static_cast<void>(nd::array<int, 3>::from_string("[1, 2]")), std::invalid_argument);
+        EXPECT_THROW(static_cast<void>(nd::array<int, 2, 2>::from_string("[[1, 2] [3, 4] [5, 6]]")), std::invalid_argument);
+    }
+}
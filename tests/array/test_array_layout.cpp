@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/array.h"
+
+TEST(nd_array, layout)
+{
+    using array_f = nd::basic_array<int, nd::layout::first_axis_contiguous, 4, 3, 2>;
+
+    static_assert(std::is_same_v<nd::array<int, 2, 2>, nd::basic_array<int, nd::layout::last_axis_contiguous, 2, 2>>);
+    static_assert(array_f::memory_layout() == nd::layout::first_axis_contiguous);
+    static_assert(array_f::stride(0) == 1);
+    static_assert(array_f::stride(1) == 4);
+    static_assert(array_f::stride(2) == 12);
+    static_assert(array_f::grid_to_list_id(3, 2, 1) == 23);
+    static_assert(array_f::list_to_grid_id(23)[0] == 3);
+    static_assert(array_f::list_to_grid_id(23)[1] == 2);
+    static_assert(array_f::list_to_grid_id(23)[2] == 1);
+
+    for (std::size_t lid = 0; lid < array_f::num_values(); ++lid)
+    {
+        EXPECT_EQ(array_f::grid_to_list_id(array_f::list_to_grid_id(lid)), lid);
+    }
+
+    array_f a;
+    std::iota(a.begin(), a.end(), 0);
+    EXPECT_EQ(a(1, 0, 0), 1);
+    EXPECT_EQ(a(0, 1, 0), 4);
+    EXPECT_EQ(a(0, 0, 1), 12);
+
+    nd::array<int, 4, 3, 2> b;
+    for (std::size_t lid = 0; lid < b.num_values(); ++lid)
+    {
+        const auto gid = b.list_to_grid_id(lid);
+        b[lid] = a(gid);
+    }
+
+    EXPECT_EQ(a.to_string(), b.to_string());
+    EXPECT_EQ(array_f::from_string(b.to_string()), a);
+}
@@ -22,6 +22,12 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
 #include "common.h"
 #include "nd/array.h"
 
@@ -74,3 +80,26 @@ TEST(nd_array, list_to_grid_id)
         EXPECT_EQ(gid4[2], 4);
     }
 }
+
+TEST(nd_array, list_to_grid_ids)
+{
+    using array_type = nd::array<int, 5, 7, 6>;
+
+    constexpr auto gid = array_type::list_to_grid_id(4 * 42 + 3 * 6 + 5);
+    static_assert(gid[0] == 4 && gid[1] == 3 && gid[2] == 5);
+
+    constexpr auto gidCm = nd::basic_array<int, nd::layout::first_axis_contiguous, 5, 7, 6>::list_to_grid_id(4 + 3 * 5 + 5 * 35);
+    static_assert(gidCm[0] == 4 && gidCm[1] == 3 && gidCm[2] == 5);
+
+    std::vector<std::size_t> lids(array_type::num_values());
+    std::iota(lids.begin(), lids.end(), 0U);
+
+    std::vector<std::size_t> gids;
+    array_type::list_to_grid_ids(lids.begin(), lids.end(), std::back_inserter(gids));
+    ASSERT_EQ(gids.size(), 3 * lids.size());
+
+    for (std::size_t lid = 0; lid < array_type::num_values(); ++lid)
+    {
+        EXPECT_EQ(array_type::grid_to_list_id(gids[3 * lid], gids[3 * lid + 1], gids[3 * lid + 2]), lid);
+    }
+}
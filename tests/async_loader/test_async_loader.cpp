@@ -0,0 +1,113 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+
+#include "common.h"
+#include "nd/async_loader.h"
+#include "nd/csv.h"
+#include "nd/grid.h"
+
+TEST(nd_async_loader, acquire_release)
+{
+    for (std::size_t numBuffers : {1U, 2U, 3U})
+    {
+        int next = 0;
+        nd::async_loader<nd::grid<int, 2>> loader([&next](nd::grid<int, 2>& g)
+                                                  {
+                                                      if (next == 20)
+                                                      { return false; }
+
+                                                      g.resize({4, 4}, 0);
+                                                      g.fill(next++);
+                                                      return true;
+                                                  }, numBuffers);
+
+        int expected = 0;
+        while (nd::grid<int, 2>* g = loader.acquire())
+        {
+            EXPECT_EQ(g->num_values(), 16U);
+            EXPECT_EQ((*g)(3, 3), expected++);
+            loader.release(g);
+        }
+
+        EXPECT_EQ(expected, 20);
+        EXPECT_TRUE(loader.done());
+        EXPECT_EQ(loader.acquire(), nullptr);
+    }
+    {
+        // consumer stops early; destructor must not hang
+        nd::async_loader<std::vector<int>> loader([](std::vector<int>& v)
+                                                  {
+                                                      v.assign(100, 1);
+                                                      return true;
+                                                  }, 3);
+
+        std::vector<int>* v = loader.acquire();
+        EXPECT_EQ(v->size(), 100U);
+        EXPECT_FALSE(loader.done());
+    }
+    {
+        int next = 0;
+        nd::async_loader<nd::grid<int, 1>> loader([&next](nd::grid<int, 1>&)
+                                                  {
+                                                      if (next++ == 2)
+                                                      { throw std::runtime_error("load failed"); }
+
+                                                      return true;
+                                                  });
+
+        loader.release(loader.acquire());
+        loader.release(loader.acquire());
+        EXPECT_THROW(static_cast<void>(loader.acquire()), std::runtime_error);
+        EXPECT_EQ(loader.acquire(), nullptr);
+    }
+}
+
+TEST(nd_async_loader, load_files_async)
+{
+    std::vector<std::string> paths;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        nd::grid<int, 2> g(3, 2);
+        g.fill(i);
+
+        paths.push_back(::testing::TempDir() + "nd_async_loader_" + std::to_string(i) + ".csv");
+        nd::write_csv(paths.back(), g);
+    }
+
+    auto loader = nd::load_files_async<nd::grid<int, 2>>(paths, [](const std::string& p)
+    { return nd::read_csv<int>(p); });
+
+    int i = 0;
+    while (nd::grid<int, 2>* g = loader.acquire())
+    {
+        EXPECT_EQ(g->size(0), 3U);
+        EXPECT_EQ((*g)(2, 1), i++);
+        loader.release(g);
+    }
+
+    EXPECT_EQ(i, 4);
+}
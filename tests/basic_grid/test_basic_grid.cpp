@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+
+#include "common.h"
+#include "nd/basic_grid.h"
+#include "nd/grid.h"
+
+TEST(nd_basic_grid, extents)
+{
+    using e = nd::extents<nd::dyn, 4, nd::dyn, 3>;
+
+    static_assert(e::rank() == 4);
+    static_assert(e::rank_dynamic() == 2);
+    static_assert(e::static_extent(1) == 4);
+    static_assert(e::static_extent(2) == nd::dyn);
+    static_assert(nd::extents<2, 3>::static_num_values() == 6);
+
+    constexpr e a(5, 6);
+    static_assert(a.extent(0) == 5 && a.extent(1) == 4 && a.extent(2) == 6 && a.extent<3>() == 3);
+    static_assert(e(5, 4, 6, 3) == a);
+    static_assert(e(5, 7) != a);
+    EXPECT_EQ(a.sizes(), (std::array<unsigned int, 4>{5, 4, 6, 3}));
+}
+
+TEST(nd_basic_grid, mixed_extents)
+{
+    using image = nd::basic_grid<float, nd::extents<nd::dyn, nd::dyn, 3>>;
+
+    static_assert(image::static_stride(2) == 1);
+    static_assert(image::static_stride(1) == 3);
+    static_assert(image::static_stride(0) == nd::dyn);
+    static_assert(std::is_same_v<image::data_container_type, std::vector<float>>);
+
+    image img(4, 5);
+    EXPECT_EQ(img.size(), (std::array<unsigned int, 3>{4, 5, 3}));
+    EXPECT_EQ(img.strides(), (std::array<unsigned int, 3>{15, 3, 1}));
+    EXPECT_EQ(img.num_values(), 60U);
+    EXPECT_EQ(img.size<2>(), 3U);
+
+    for (unsigned int i = 0; i < img.num_values(); ++i)
+    {
+        img[i] = static_cast<float>(i);
+    }
+
+    EXPECT_EQ(img(2, 3, 1), 2 * 15 + 3 * 3 + 1);
+    EXPECT_EQ(img(std::array<int, 3>{1, 4, 2}), 15 + 12 + 2);
+    EXPECT_EQ(img.list_to_grid_id(44), (std::array<unsigned int, 3>{2, 4, 2}));
+    EXPECT_THROW((void) img.at_grid(4, 0, 0), std::out_of_range);
+    EXPECT_THROW((void) img.at_grid(0, 0, 3), std::out_of_range);
+
+    const nd::grid<float, 3> g = img.to_grid();
+    EXPECT_EQ(g(2, 3, 1), img(2, 3, 1));
+    EXPECT_TRUE((image(g) == img));
+    EXPECT_THROW((nd::basic_grid<float, nd::extents<nd::dyn, nd::dyn, 4>>(g)), std::invalid_argument);
+
+    using column_major = nd::basic_grid<int, nd::extents<3, nd::dyn>, nd::layout::first_axis_contiguous>;
+    static_assert(column_major::static_stride(0) == 1);
+    static_assert(column_major::static_stride(1) == 3);
+
+    column_major c(7);
+    c(2, 5) = 9;
+    EXPECT_EQ(c.data()[2 + 5 * 3], 9);
+    EXPECT_EQ(c.list_to_grid_id(17), (std::array<unsigned int, 2>{2, 5}));
+}
+
+TEST(nd_basic_grid, static_extents)
+{
+    using mat = nd::basic_grid<int, nd::extents<2, 3>>;
+
+    static_assert(mat::is_static());
+    static_assert(std::is_same_v<mat::data_container_type, std::array<int, 6>>);
+    static_assert(sizeof(mat) < sizeof(std::array<int, 6>) + sizeof(std::array<unsigned int, 2>)); // no stored sizes / strides
+
+    mat m;
+    EXPECT_EQ(m.num_values(), 6U);
+    EXPECT_EQ(m.strides(), (std::array<unsigned int, 2>{3, 1}));
+
+    m(1, 2) = 5;
+    EXPECT_EQ(m.data()[5], 5);
+    EXPECT_EQ(m.to_grid()(1, 2), 5);
+}
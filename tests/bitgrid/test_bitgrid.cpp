@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <random>
+
+#include "common.h"
+#include "nd/bitgrid.h"
+#include "nd/grid.h"
+
+namespace
+{
+//! random 0/1 grid
+nd::grid<int, 3>
+make_random_grid(unsigned int seed)
+{
+    std::mt19937                    rng(seed);
+    std::uniform_int_distribution<> dist(0, 1);
+
+    nd::grid<int, 3> g(5, 7, 131);
+    for (auto& x: g)
+    {
+        x = dist(rng);
+    }
+
+    return g;
+}
+} // namespace
+
+TEST(nd_bitgrid, access)
+{
+    nd::bitgrid<2> m(3, 70);
+
+    EXPECT_EQ(m.words_per_row(), 2U);
+    EXPECT_EQ(m.num_values(), 210U);
+    EXPECT_TRUE(m.none());
+
+    m(1, 65) = true;
+    m(std::array<int, 2>{2, 3}) = true;
+    EXPECT_TRUE(m(1, 65));
+    EXPECT_TRUE(m(2, 3));
+    EXPECT_FALSE(m(1, 64));
+    EXPECT_EQ(m.count(), 2U);
+
+    m(1, 65) = m(0, 0);
+    EXPECT_FALSE(m(1, 65));
+
+    m.fill(true);
+    EXPECT_TRUE(m.all());
+    EXPECT_EQ(m.count(), 210U);
+
+    m(2, 69) = false;
+    EXPECT_FALSE(m.all());
+    EXPECT_TRUE(m.any());
+
+    m.flip();
+    EXPECT_EQ(m.count(), 1U);
+    EXPECT_TRUE(m(2, 69));
+}
+
+TEST(nd_bitgrid, grid_conversion_and_logic)
+{
+    const nd::grid<int, 3> a = make_random_grid(1);
+    const nd::grid<int, 3> b = make_random_grid(2);
+
+    for (unsigned int numThreads: {1U, 3U})
+    {
+        const nd::bitgrid<3> ma(a, numThreads);
+        const nd::bitgrid<3> mb(b, [](int x)
+        {
+            return x == 1;
+        }, numThreads);
+
+        EXPECT_TRUE((ma.to_grid<int>(numThreads) == a));
+        EXPECT_TRUE((mb.to_grid<int>(numThreads) == b));
+
+        const nd::bitgrid<3> mAnd = ma & mb;
+        const nd::bitgrid<3> mOr  = ma | mb;
+        const nd::bitgrid<3> mXor = ma ^ mb;
+        const nd::bitgrid<3> mNot = ~ma;
+
+        std::size_t numA = 0;
+
+        for (unsigned int lid = 0; lid < a.num_values(); ++lid)
+        {
+            const auto gid = a.list_to_grid_id(lid);
+
+            numA += a[lid];
+            EXPECT_EQ(mAnd(gid), a[lid] && b[lid]);
+            EXPECT_EQ(mOr(gid), a[lid] || b[lid]);
+            EXPECT_EQ(mXor(gid), a[lid] != b[lid]);
+            EXPECT_EQ(mNot(gid), !a[lid]);
+        }
+
+        EXPECT_EQ(ma.count(), numA);
+        EXPECT_EQ(mNot.count(), a.num_values() - numA);
+        EXPECT_EQ(nd::bitgrid<3>(ma).subtract(mb), ma & ~mb);
+    }
+
+    const nd::grid<bool, 3> gb = nd::bitgrid<3>(a).to_grid<bool>();
+    EXPECT_EQ(gb.data()[gb.grid_to_list_id(4, 6, 130)], a(4, 6, 130) == 1);
+
+    // grid<bool> -> bitgrid
+    for (unsigned int numThreads: {1U, 3U})
+    {
+        const nd::bitgrid<3> mb(gb, numThreads);
+        EXPECT_EQ(mb.count(), nd::bitgrid<3>(a).count());
+        EXPECT_EQ(mb, nd::bitgrid<3>(a));
+    }
+
+    EXPECT_EQ(nd::bitgrid<2>(nd::grid<bool, 2>({3, 4}, true)).count(), 12U);
+    EXPECT_EQ(nd::bitgrid<2>(nd::grid<bool, 2>({3, 4}, true), [](bool x) { return !x; }).count(), 0U);
+}
+
+TEST(nd_bitgrid, shift)
+{
+    const nd::grid<int, 3> a = make_random_grid(3);
+    const nd::bitgrid<3>   ma(a);
+
+    for (unsigned int dim = 0; dim < 3; ++dim)
+    {
+        for (int delta: {-130, -65, -64, -3, -1, 1, 2, 63, 64, 100, 131})
+        {
+            nd::bitgrid<3> s = ma;
+            s.shift(dim, delta);
+
+            for (unsigned int lid = 0; lid < a.num_values(); ++lid)
+            {
+                auto      gid = a.list_to_grid_id(lid);
+                const int src = static_cast<int>(gid[dim]) - delta;
+                bool      expected = false;
+
+                if (src >= 0 && src < static_cast<int>(a.size(dim)))
+                {
+                    gid[dim] = static_cast<unsigned int>(src);
+                    expected = a(gid) == 1;
+                    gid[dim] = static_cast<unsigned int>(src + delta);
+                }
+
+                ASSERT_EQ(s(gid), expected) << "dim " << dim << " delta " << delta;
+            }
+
+            EXPECT_TRUE(((~s).count() + s.count() == s.num_values()));
+        }
+    }
+}
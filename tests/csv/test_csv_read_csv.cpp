@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <fstream>
+
+#include "common.h"
+#include "nd/csv.h"
+
+TEST(nd_csv, read_csv)
+{
+    const std::string path = ::testing::TempDir() + "nd_csv_read.csv";
+
+    {
+        std::ofstream f(path);
+        f << "1, 2.5,3\r\n"
+             "\n"
+             "-4,5e2 , 6\n"
+             "7,8,9";
+    }
+
+    {
+        const nd::grid<double, 2> a = nd::read_csv<double>(path);
+        EXPECT_EQ(a.size(0), 3U);
+        EXPECT_EQ(a.size(1), 3U);
+        EXPECT_DOUBLE_EQ(a(0, 1), 2.5);
+        EXPECT_DOUBLE_EQ(a(1, 0), -4.0);
+        EXPECT_DOUBLE_EQ(a(1, 1), 500.0);
+        EXPECT_DOUBLE_EQ(a(2, 2), 9.0);
+    }
+    {
+        // more threads than lines
+        const nd::grid<float, 2> a = nd::read_csv<float>(path, ',', 3, 16);
+        EXPECT_EQ(a.size(0), 3U);
+        EXPECT_FLOAT_EQ(a(2, 0), 7.0f);
+    }
+    {
+        EXPECT_THROW(nd::read_csv<double>(path, ',', 4), std::runtime_error);
+        EXPECT_THROW(nd::read_csv<int>(path), std::runtime_error); // 2.5 is not an int
+        EXPECT_THROW(nd::read_csv<int>(path + ".does_not_exist"), std::runtime_error);
+    }
+    {
+        std::ofstream f(path);
+        f << "1,2,3\n4,5\n";
+        f.close();
+
+        EXPECT_THROW(nd::read_csv<int>(path), std::runtime_error);
+    }
+    {
+        std::ofstream f(path);
+        f.close();
+
+        EXPECT_TRUE(nd::read_csv<int>(path).empty());
+    }
+}
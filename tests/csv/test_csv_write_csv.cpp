@@ -0,0 +1,50 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/csv.h"
+
+TEST(nd_csv, write_csv)
+{
+    const std::string path = ::testing::TempDir() + "nd_csv_write.csv";
+
+    {
+        nd::grid<int, 2> a(1000, 7);
+        std::iota(a.begin(), a.end(), -3000);
+
+        for (unsigned int numThreads : {1U, 3U, 0U})
+        {
+            nd::write_csv(path, a, ',', numThreads);
+            EXPECT_EQ(nd::read_csv<int>(path, ',', 7, numThreads), a);
+        }
+    }
+    {
+        nd::grid<double, 2> a(13, 5);
+        for (unsigned int i = 0; i < a.num_values(); ++i)
+        { a[i] = 1.0 / (i + 1); }
+
+        nd::write_csv(path, a, '\t', 4);
+        EXPECT_EQ(nd::read_csv<double>(path, '\t', 0, 2), a); // shortest round-trip representation
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/grid.h"
+
+TEST(nd_grid, append_slice)
+{
+    {
+        nd::grid<int, 3> a;
+        a.reserve(4, 2, 3);
+        const int* storage = a.data().data();
+
+        for (int z = 0; z < 4; ++z)
+        {
+            nd::grid<int, 2> slice(2, 3);
+            std::iota(slice.begin(), slice.end(), 10 * z);
+            a.append_slice(slice);
+        }
+
+        EXPECT_EQ(a.data().data(), storage); // reserved: no reallocation
+        EXPECT_EQ(a.size(0), 4U);
+        EXPECT_EQ(a.size(1), 2U);
+        EXPECT_EQ(a.size(2), 3U);
+        EXPECT_EQ(a.num_values(), 24U);
+        EXPECT_EQ(a.stride(0), 6U);
+        EXPECT_EQ(a.stride(1), 3U);
+        EXPECT_EQ(a.stride(2), 1U);
+
+        for (int z = 0; z < 4; ++z)
+        {
+            EXPECT_EQ(a(z, 0, 0), 10 * z);
+            EXPECT_EQ(a(z, 1, 2), 10 * z + 5);
+        }
+    }
+    {
+        nd::grid<double, 2> a(1, 3);
+        a.fill(1.0);
+
+        const std::vector<double> row{4.0, 5.0, 6.0};
+        a.append_slice(row.begin(), row.end());
+
+        nd::grid<float, 1> slice(3);
+        slice.fill(7.0f);
+        a.append_slice(slice);
+
+        EXPECT_EQ(a.size(0), 3U);
+        EXPECT_EQ(a(0, 2), 1.0);
+        EXPECT_EQ(a(1, 1), 5.0);
+        EXPECT_EQ(a(2, 0), 7.0);
+    }
+    {
+        nd::grid<int, 3> a;
+        a.append_slice(nd::grid<int, 2>(2, 2));
+        EXPECT_THROW(a.append_slice(nd::grid<int, 2>(2, 3)), std::invalid_argument);
+
+        const std::vector<int> values(3);
+        EXPECT_THROW(a.append_slice(values.begin(), values.end()), std::invalid_argument);
+        EXPECT_EQ(a.size(0), 1U);
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/grid.h"
+
+TEST(nd_grid, from_string)
+{
+    {
+        nd::grid<int, 1> a({5});
+        a.set_values(1, -2, 3, 4, 5);
+        EXPECT_EQ(a.to_string(), "[1, -2, 3, 4, 5]");
+
+        const auto b = nd::grid<int, 1>::from_string(a.to_string());
+        EXPECT_EQ(b, a);
+    }
+    {
+        nd::grid<int, 2> a({3, 2});
+        std::iota(a.begin(), a.end(), 0);
+        EXPECT_EQ(a.to_string(), "[[0, 2, 4]\n [1, 3, 5]]");
+
+        const auto b = nd::grid<int, 2>::from_string(a.to_string());
+        EXPECT_EQ(b.size(0), 3U);
+        EXPECT_EQ(b.size(1), 2U);
+        EXPECT_EQ(b, a);
+    }
+    {
+        nd::grid<double, 3> a({2, 3, 4});
+        for (unsigned int i = 0; i < a.num_values(); ++i)
+        { a[i] = i / 3.0 - 2.5; }
+
+        const std::string str = a.to_string();
+        EXPECT_EQ(str.substr(0, 24), "[(0,0,0)=-2.5, (0,0,1)=-");
+
+        const auto b = nd::grid<double, 3>::from_string(str);
+        EXPECT_EQ(b.size(0), 2U);
+        EXPECT_EQ(b.size(1), 3U);
+        EXPECT_EQ(b.size(2), 4U);
+        EXPECT_EQ(b, a); // shortest round-trip representation
+    }
+    {
+        std::string str;
+        nd::grid<int, 2> a({2, 2}, 7);
+        a.format_to(std::back_inserter(str));
+        EXPECT_EQ(str, a.to_string());
+    }
+    {
+        const auto a = nd::grid<int, 2>::from_string("[]");
+        EXPECT_TRUE(a.empty());
+    }
+    {
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 2>::from_string("[1, 2]")), std::invalid_argument);
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 2>::from_string("[[1, 2] [3]]")), std::invalid_argument);
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 1>::from_string("[1, x]")), std::invalid_argument);
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 1>::from_string("[1, 2")), std::invalid_argument);
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 3>::from_string("[(0,0,0)=1, (0,0,1)=2, (0,1,1)=3]")), std::invalid_argument);
+    }
+    {
+        // 3D+ ids must follow list order, even if the number of values matches the last id
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 3>::from_string("[(0,0,0)=1, (0,1,0)=2, (0,0,1)=3, (0,1,1)=4]")), std::invalid_argument); // permuted
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 3>::from_string("[(0,0,0)=1, (0,0,1)=2, (0,0,1)=3, (0,0,3)=4]")), std::invalid_argument); // duplicated
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 3>::from_string("[(0,0,0)=1, (0,0,2)=2, (0,1,0)=3, (0,1,1)=4]")), std::invalid_argument); // gap
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 3>::from_string("[(0,0,1)=1, (0,0,2)=2]")), std::invalid_argument); // not starting at 0
+        EXPECT_THROW(static_cast<void>(nd::grid<int, 3>::from_string("[(0,0,0)=1, (0,0,1)=2, (0,1,0)=3, (0,1,1)=4, (0,1,2)=5, (0,2,0)=6]")), std::invalid_argument); // ragged
+
+        nd::grid<int, 4> a({2, 1, 3, 1});
+        std::iota(a.begin(), a.end(), 0);
+        EXPECT_EQ((nd::grid<int, 4>::from_string(a.to_string())), a);
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/grid.h"
+
+TEST(nd_grid, layout)
+{
+    using grid_f = nd::grid<int, 3, nd::layout::first_axis_contiguous>;
+
+    static_assert(nd::grid<int, 3>::memory_layout() == nd::layout::last_axis_contiguous);
+    static_assert(grid_f::memory_layout() == nd::layout::first_axis_contiguous);
+
+    // strides: dimension 0 is contiguous
+    grid_f a(4, 3, 2);
+    EXPECT_EQ(a.stride(0), 1U);
+    EXPECT_EQ(a.stride(1), 4U);
+    EXPECT_EQ(a.stride(2), 12U);
+    EXPECT_EQ(a.grid_to_list_id(1, 0, 0), 1U);
+    EXPECT_EQ(a.grid_to_list_id(3, 2, 1), 3U + 2U * 4U + 12U);
+
+    // list id <-> grid id round trip
+    for (unsigned int lid = 0; lid < a.num_values(); ++lid)
+    {
+        const auto gid = a.list_to_grid_id(lid);
+        EXPECT_EQ(a.grid_to_list_id(gid), lid);
+    }
+
+    // iterators run in memory order, i.e., x fastest
+    std::iota(a.begin(), a.end(), 0);
+    EXPECT_EQ(a(0, 0, 0), 0);
+    EXPECT_EQ(a(1, 0, 0), 1);
+    EXPECT_EQ(a(0, 1, 0), 4);
+    EXPECT_EQ(a(0, 0, 1), 12);
+
+    // same element <-> same (x, y, z) after a layout conversion
+    const nd::grid<int, 3> b(a);
+    const grid_f           c(b);
+    EXPECT_EQ(b.stride(2), 1U);
+    EXPECT_EQ(c, a);
+
+    for (unsigned int x = 0; x < 4; ++x)
+    {
+        for (unsigned int y = 0; y < 3; ++y)
+        {
+            for (unsigned int z = 0; z < 2; ++z)
+            {
+                EXPECT_EQ(b(x, y, z), a(x, y, z));
+            }
+        }
+    }
+
+    // the text format does not depend on the layout
+    EXPECT_EQ(a.to_string(), b.to_string());
+    EXPECT_EQ(grid_f::from_string(b.to_string()), a);
+
+    nd::grid<int, 2, nd::layout::first_axis_contiguous> d(3, 2);
+    std::iota(d.begin(), d.end(), 0);
+    EXPECT_EQ(d.to_string(), "[[0, 1, 2]\n [3, 4, 5]]");
+    EXPECT_EQ(decltype(d)::from_string(d.to_string()), d);
+
+    // slices are appended along the last dimension
+    nd::grid<int, 2, nd::layout::first_axis_contiguous> e;
+    nd::grid<int, 1> slice(3);
+    std::iota(slice.begin(), slice.end(), 0);
+    e.append_slice(slice);
+    e.append_slice(nd::grid<int, 1>(3));
+    EXPECT_EQ(e.size(0), 3U);
+    EXPECT_EQ(e.size(1), 2U);
+    EXPECT_EQ(e(2, 0), 2);
+    EXPECT_EQ(e(2, 1), 0);
+}
@@ -22,6 +22,12 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
 #include "common.h"
 #include "nd/grid.h"
 
@@ -74,3 +80,36 @@ TEST(nd_grid, list_to_grid_id)
         EXPECT_EQ(gid4[2], 4);
     }
 }
+
+TEST(nd_grid, list_to_grid_ids)
+{
+    nd::grid<int, 3> a({5, 7, 6});
+
+    std::vector<unsigned int> lids(a.num_values());
+    std::iota(lids.begin(), lids.end(), 0U);
+
+    std::vector<unsigned int> gids;
+    a.list_to_grid_ids(lids.begin(), lids.end(), std::back_inserter(gids));
+    ASSERT_EQ(gids.size(), 3 * lids.size());
+
+    for (unsigned int lid = 0; lid < a.num_values(); ++lid)
+    {
+        const auto gid = a.list_to_grid_id(lid);
+        EXPECT_EQ(gids[3 * lid], gid[0]);
+        EXPECT_EQ(gids[3 * lid + 1], gid[1]);
+        EXPECT_EQ(gids[3 * lid + 2], gid[2]);
+        EXPECT_EQ(a.grid_to_list_id(gid), lid);
+    }
+
+    // divisors follow resize, layout conversion and swap
+    a.resize({3, 1000, 9}, 0);
+    EXPECT_EQ(a.list_to_grid_id(2 * 9000 + 123 * 9 + 4), (std::array<unsigned int, 3>{2, 123, 4}));
+
+    nd::grid<int, 3, nd::layout::first_axis_contiguous> b(a);
+    EXPECT_EQ(b.list_to_grid_id(2 + 123 * 3 + 4 * 3000), (std::array<unsigned int, 3>{2, 123, 4}));
+
+    nd::grid<int, 3> c(2, 2, 2);
+    c.swap(a);
+    EXPECT_EQ(c.list_to_grid_id(9000 + 9 + 1), (std::array<unsigned int, 3>{1, 1, 1}));
+    EXPECT_EQ(a.list_to_grid_id(7), (std::array<unsigned int, 3>{1, 1, 1}));
+}
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/vector.h"
+
+TEST(nd_grid, release)
+{
+    std::vector<float> raw(12);
+    std::iota(raw.begin(), raw.end(), 0.0F);
+    const float* p = raw.data();
+
+    // adopt
+    nd::grid<float, 2> g = nd::grid<float, 2>::from_vector(std::move(raw), {3, 4});
+    EXPECT_EQ(g.data().data(), p);
+    EXPECT_EQ(g.size(0), 3U);
+    EXPECT_EQ(g.size(1), 4U);
+    EXPECT_EQ(g.stride(0), 4U);
+    EXPECT_EQ(g(2, 1), 9.0F);
+
+    EXPECT_THROW(static_cast<void>(nd::grid<float, 2>::from_vector(std::vector<float>(5), {3, 4})), std::invalid_argument);
+
+    // release
+    std::vector<float> values = g.release();
+    EXPECT_EQ(values.data(), p);
+    EXPECT_EQ(values.size(), 12U);
+    EXPECT_TRUE(g.empty());
+    EXPECT_EQ(g.size(0), 0U);
+
+    // vector -> grid
+    nd::vector<float> v = nd::vector<float>::from_vector(std::move(values), {2, 3, 2});
+    nd::grid<float, 3> g3(std::move(v));
+    EXPECT_EQ(g3.data().data(), p);
+    EXPECT_EQ(g3.size(1), 3U);
+    EXPECT_EQ(g3(1, 2, 1), 11.0F);
+    EXPECT_TRUE(v.empty());
+
+    nd::vector<float> v2(2, 6);
+    EXPECT_THROW((nd::grid<float, 3>(std::move(v2))), std::invalid_argument);
+    EXPECT_EQ(v2.num_values(), 12U);
+}
@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/grid_view.h"
+#include "nd/vector.h"
+
+namespace
+{
+//! generic over the rank; used by visit() below
+template<typename TView>
+double
+weighted_sum(TView v)
+{
+    double s = 0;
+
+    for (typename TView::size_type lid = 0; lid < v.num_values(); ++lid)
+    {
+        const auto gid = v.list_to_grid_id(lid);
+        EXPECT_EQ(v.grid_to_list_id(gid), lid);
+        s += static_cast<double>(v(gid)) * (gid[0] + 1);
+    }
+
+    return s;
+}
+} // namespace
+
+TEST(nd_grid_view, from_grid)
+{
+    nd::grid<int, 3> g(2, 3, 4);
+    std::iota(g.begin(), g.end(), 0);
+
+    nd::grid_view<int, 3> v(g);
+    EXPECT_EQ(v.data(), g.data().data());
+    EXPECT_EQ(v.num_values(), 24U);
+    EXPECT_EQ(v.size(1), 3U);
+    EXPECT_EQ(v.stride(0), g.stride(0));
+    EXPECT_EQ(v(1, 2, 3), g(1, 2, 3));
+
+    v(0, 1, 2) = -1;
+    EXPECT_EQ(g(0, 1, 2), -1);
+    EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0), std::accumulate(g.begin(), g.end(), 0));
+
+    const nd::grid_view<const int, 3> cv = v;
+    EXPECT_EQ(cv(1, 1, 1), g(1, 1, 1));
+    static_assert(!std::is_assignable_v<decltype(cv(0, 0, 0)), int>);
+
+    EXPECT_TRUE((nd::grid_view<float, 2>().empty()));
+}
+
+TEST(nd_grid_view, column_major)
+{
+    nd::grid<int, 3, nd::layout::first_axis_contiguous> g(2, 3, 4);
+    std::iota(g.begin(), g.end(), 0);
+
+    nd::grid_view<int, 3> v(g);
+    EXPECT_EQ(v.stride(0), 1U);
+
+    for (unsigned int lid = 0; lid < g.num_values(); ++lid)
+    {
+        const auto gid = g.list_to_grid_id(lid);
+        EXPECT_EQ(v.list_to_grid_id(lid)[0], gid[0]);
+        EXPECT_EQ(v.list_to_grid_id(lid)[2], gid[2]);
+        EXPECT_EQ(v(gid[0], gid[1], gid[2]), static_cast<int>(lid));
+    }
+}
+
+TEST(nd_grid_view, column_major_unit_size)
+{
+    // strides (1, 1): the layout is not visible in the strides
+    nd::grid<int, 2, nd::layout::first_axis_contiguous> g(1, 5);
+    std::iota(g.begin(), g.end(), 0);
+
+    const nd::grid_view<const int, 2> v(g);
+    EXPECT_EQ(v.memory_layout(), nd::layout::first_axis_contiguous);
+
+    nd::vector<int, nd::layout::first_axis_contiguous> vec(g.size().begin(), g.size().end());
+
+    for (unsigned int lid = 0; lid < g.num_values(); ++lid)
+    {
+        EXPECT_EQ(v.list_to_grid_id(lid)[0], 0U);
+        EXPECT_EQ(v.list_to_grid_id(lid)[1], lid);
+    }
+
+    vec.visit([](auto w)
+    {
+        if constexpr (decltype(w)::num_dimensions() == 2)
+        {
+            EXPECT_EQ(w.memory_layout(), nd::layout::first_axis_contiguous);
+            EXPECT_EQ(w.list_to_grid_id(3)[0], 0U);
+            EXPECT_EQ(w.list_to_grid_id(3)[1], 3U);
+        }
+    });
+}
+
+TEST(nd_grid_view, visit)
+{
+    for (unsigned int n = 1; n <= 8; ++n)
+    {
+        std::vector<unsigned int> sizes(n, 2);
+        sizes[0] = 3;
+
+        nd::vector<float> vec(sizes.begin(), sizes.end(), 1.0F);
+        std::iota(vec.begin(), vec.end(), 0.0F);
+
+        double expected = 0;
+        for (unsigned int lid = 0; lid < vec.num_values(); ++lid)
+        {
+            expected += static_cast<double>(vec[lid]) * (vec.list_to_grid_id(lid)[0] + 1);
+        }
+
+        const std::size_t rank = vec.visit([](auto v) { return decltype(v)::num_dimensions(); });
+        EXPECT_EQ(rank, n);
+        EXPECT_DOUBLE_EQ(vec.visit([](auto v) { return weighted_sum(v); }), expected);
+    }
+}
+
+TEST(nd_grid_view, visit_write)
+{
+    nd::vector<int> vec({4, 5}, 0);
+
+    // f is instantiated for every rank, rank-specific code goes behind if constexpr
+    vec.visit([](auto v)
+    {
+        if constexpr (decltype(v)::num_dimensions() == 2)
+        {
+            for (unsigned int x = 0; x < v.size(0); ++x)
+            {
+                for (unsigned int y = 0; y < v.size(1); ++y)
+                {
+                    v(x, y) = static_cast<int>(10 * x + y);
+                }
+            }
+        }
+    });
+
+    EXPECT_EQ(vec(3, 4), 34);
+    EXPECT_EQ(vec(1, 2), 12);
+
+    const nd::vector<int>& cvec = vec;
+    cvec.visit([](auto v)
+    {
+        static_assert(std::is_const_v<typename decltype(v)::element_type>);
+    });
+
+    const std::vector<unsigned int> sizes9(9, 1);
+    nd::vector<int> tooLarge(sizes9.begin(), sizes9.end(), 0);
+    EXPECT_THROW(tooLarge.visit([](auto) { }), std::invalid_argument);
+}
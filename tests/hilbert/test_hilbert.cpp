@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdlib>
+
+#include "common.h"
+#include "nd/array.h"
+#include "nd/grid.h"
+#include "nd/hilbert.h"
+#include "nd/vector.h"
+
+namespace
+{
+//! checks that all positions are visited once, that list ids match and returns the number of non-neighbour steps
+template<std::size_t N, typename TContainer>
+unsigned int
+check_hilbert_range(const TContainer& c)
+{
+    std::vector<int>            visited(c.num_values(), 0);
+    std::array<unsigned int, N> prev{};
+    unsigned int                numJumps = 0;
+    std::size_t                 n        = 0;
+
+    for (const auto& [gid, lid]: nd::hilbert_range<N>(c))
+    {
+        for (std::size_t k = 0; k < N; ++k)
+        {
+            EXPECT_LT(gid[k], c.size()[k]);
+        }
+
+        EXPECT_EQ(lid, c.grid_to_list_id(gid));
+        ++visited[lid];
+
+        if (n++ != 0)
+        {
+            int dist = 0;
+            for (std::size_t k = 0; k < N; ++k)
+            {
+                dist += std::abs(static_cast<int>(gid[k]) - static_cast<int>(prev[k]));
+            }
+
+            numJumps += dist != 1;
+        }
+
+        prev = gid;
+    }
+
+    EXPECT_EQ(n, static_cast<std::size_t>(c.num_values()));
+    EXPECT_TRUE(std::all_of(visited.begin(), visited.end(), [](int x){return x == 1;}));
+
+    return numJumps;
+}
+} // namespace
+
+TEST(nd_hilbert, hilbert_range_2d)
+{
+    {
+        const nd::grid<int, 2> g(2, 2);
+
+        std::vector<std::array<unsigned int, 2>> order;
+        for (const auto& [gid, lid]: nd::hilbert_range(g))
+        {
+            order.push_back(gid);
+        }
+
+        ASSERT_EQ(order.size(), 4U);
+        EXPECT_EQ(order[0], (std::array<unsigned int, 2>{0, 0}));
+        EXPECT_EQ(order[1], (std::array<unsigned int, 2>{0, 1}));
+        EXPECT_EQ(order[2], (std::array<unsigned int, 2>{1, 1}));
+        EXPECT_EQ(order[3], (std::array<unsigned int, 2>{1, 0}));
+    }
+
+    EXPECT_EQ(check_hilbert_range<2>(nd::grid<int, 2>(16, 16)), 0U);
+    EXPECT_EQ(check_hilbert_range<2>(nd::grid<int, 2>(1, 9)), 0U);
+    EXPECT_EQ(check_hilbert_range<2>(nd::array<int, 6, 4>()), 0U);
+    EXPECT_EQ(check_hilbert_range<2>(nd::grid<int, 2, nd::layout::first_axis_contiguous>(24, 10)), 0U);
+    check_hilbert_range<2>(nd::grid<int, 2>(13, 7));
+    check_hilbert_range<2>(nd::grid<int, 2>(100, 3));
+
+    const nd::grid<int, 2> e;
+    EXPECT_TRUE(nd::hilbert_range(e).begin() == nd::hilbert_range(e).end());
+}
+
+TEST(nd_hilbert, hilbert_range_3d)
+{
+    EXPECT_EQ(check_hilbert_range<3>(nd::grid<int, 3>(8, 8, 8)), 0U);
+    EXPECT_EQ(check_hilbert_range<3>(nd::grid<int, 3>(10, 10, 10)), 0U);
+    EXPECT_EQ(check_hilbert_range<3>(nd::grid<int, 3>(4, 6, 20)), 0U);
+    EXPECT_EQ(check_hilbert_range<3>(nd::grid<int, 3>(30, 2, 4)), 0U);
+    check_hilbert_range<3>(nd::grid<int, 3>(5, 7, 3));
+    check_hilbert_range<3>(nd::grid<int, 3, nd::layout::first_axis_contiguous>(9, 4, 6));
+    check_hilbert_range<3>(nd::vector<int>(3, 8, 5));
+
+    EXPECT_THROW((void) nd::hilbert_range<3>(nd::vector<int>(3, 8)), std::invalid_argument);
+}
@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cmath>
+
+#include "common.h"
+#include "nd/kernels.h"
+
+namespace
+{
+template<typename TArray>
+constexpr double
+sum_of(const TArray& a)
+{
+    double s = 0;
+
+    for (std::size_t i = 0; i < a.num_values(); ++i)
+    {
+        s += a[i];
+    }
+
+    return s;
+}
+} // namespace
+
+TEST(nd_kernels, smoothing)
+{
+    constexpr auto b = nd::binomial_kernel<int, 3, 5>();
+    static_assert(b(1, 2) == 12);
+    static_assert(b(0, 0) == 1);
+    static_assert(b(2, 1) == 4);
+    static_assert(sum_of(b) == 64);
+
+    constexpr auto bn = nd::normalize(nd::binomial_kernel<double, 3, 3, 3>());
+    static_assert(bn(1, 1, 1) == 8.0 / 64);
+
+    constexpr auto box = nd::box_kernel<float, 2, 2>();
+    static_assert(box(1, 0) == 0.25F);
+
+    static_assert(nd::gaussian_kernel_size(1.0) == 7);
+    static_assert(nd::gaussian_kernel_size(1.5) == 11);
+    static_assert(nd::gaussian_kernel_size(0.5, 4) == 5);
+
+    constexpr auto g = nd::gaussian_kernel<double, 7, 5>(1.0);
+    EXPECT_NEAR(sum_of(g), 1.0, 1e-12);
+    EXPECT_NEAR(g(3, 2) / g(2, 2), std::exp(0.5), 1e-12);
+    EXPECT_NEAR(g(0, 2) / g(3, 2), std::exp(-4.5), 1e-12);
+    EXPECT_DOUBLE_EQ(g(1, 0), g(5, 4));
+}
+
+TEST(nd_kernels, derivatives)
+{
+    constexpr auto sx = nd::sobel_kernel<int, 1, 3, 3>();
+    static_assert(sx == nd::array<int, 3, 3>(-1, 0, 1, -2, 0, 2, -1, 0, 1));
+
+    constexpr auto sy = nd::sobel_kernel<int, 0, 3, 3>();
+    static_assert(sy == nd::array<int, 3, 3>(-1, -2, -1, 0, 0, 0, 1, 2, 1));
+
+    constexpr auto s5 = nd::sobel_kernel<int, 0, 5>();
+    static_assert(s5 == nd::array<int, 5>(-1, -2, 0, 2, 1));
+
+    constexpr auto s3d = nd::sobel_kernel<int, 2, 3, 3, 3>();
+    static_assert(s3d(1, 1, 0) == -4 && s3d(1, 1, 2) == 4 && s3d(0, 0, 2) == 1);
+    static_assert(sum_of(s3d) == 0);
+
+    constexpr auto sc = nd::scharr_kernel<int, 0>();
+    static_assert(sc == nd::array<int, 3, 3>(-3, -10, -3, 0, 0, 0, 3, 10, 3));
+    static_assert(nd::scharr_kernel<int, 2, 3>()(1, 1, 2) == 100);
+
+    constexpr auto d1 = nd::finite_difference_kernel<double, 0, 1, 5>();
+    EXPECT_NEAR(d1(0), 1.0 / 12, 1e-12);
+    EXPECT_NEAR(d1(1), -8.0 / 12, 1e-12);
+    EXPECT_NEAR(d1(2), 0.0, 1e-12);
+    EXPECT_NEAR(d1(3), 8.0 / 12, 1e-12);
+    EXPECT_NEAR(d1(4), -1.0 / 12, 1e-12);
+
+    // derivative of x^2 at 0 along dimension 1 of a 3x5 kernel
+    constexpr auto d2 = nd::finite_difference_kernel<double, 1, 2, 3, 5>();
+    double         response = 0;
+    for (std::size_t j = 0; j < 5; ++j)
+    {
+        const double x = static_cast<double>(j) - 2;
+        response += d2(1, j) * x * x;
+        EXPECT_EQ(d2(0, j), 0.0);
+    }
+    EXPECT_NEAR(response, 2.0, 1e-12);
+
+    constexpr auto l = nd::laplacian_kernel<int, 3, 3, 3>();
+    static_assert(l(1, 1, 1) == -6 && l(0, 1, 1) == 1 && l(1, 1, 2) == 1 && l(0, 0, 1) == 0);
+    static_assert(sum_of(l) == 0);
+
+    constexpr auto l5 = nd::laplacian_kernel<double, 5, 3>();
+    EXPECT_NEAR(l5(2, 1), -30.0 / 12 - 2, 1e-12);
+    EXPECT_NEAR(l5(0, 1), -1.0 / 12, 1e-12);
+    EXPECT_NEAR(l5(2, 0), 1.0, 1e-12);
+    EXPECT_NEAR(sum_of(l5), 0.0, 1e-12);
+
+    constexpr auto n = nd::normalize_abs(nd::sobel_kernel<double, 0, 3>());
+    static_assert(n(0) == -0.5 && n(2) == 0.5);
+}
@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cmath>
+
+#include "common.h"
+#include "nd/linalg.h"
+
+namespace
+{
+template<typename TMatrix>
+double
+max_abs_diff(const TMatrix& a, const TMatrix& b)
+{
+    double d = 0;
+
+    for (std::size_t i = 0; i < a.num_values(); ++i)
+    {
+        d = std::max(d, std::abs(static_cast<double>(a[i]) - static_cast<double>(b[i])));
+    }
+
+    return d;
+}
+} // namespace
+
+TEST(nd_linalg, products)
+{
+    constexpr nd::array<int, 2, 3> a(1, 2, 3, 4, 5, 6);
+    constexpr nd::array<int, 3, 2> b(7, 8, 9, 10, 11, 12);
+
+    constexpr auto ab = nd::matmul(a, b);
+    static_assert(ab == nd::array<int, 2, 2>(58, 64, 139, 154));
+
+    constexpr auto at = nd::transpose(a);
+    static_assert(at == nd::array<int, 3, 2>(1, 4, 2, 5, 3, 6));
+
+    constexpr auto y = nd::matvec(a, nd::array<int, 3>(1, 0, -1));
+    static_assert(y == nd::array<int, 2>(-2, -2));
+
+    static_assert(nd::matmul(nd::identity<int, 2>(), ab) == ab);
+
+    // same elements (i, j) with the other memory layout
+    using cm23 = nd::basic_array<int, nd::layout::first_axis_contiguous, 2, 3>;
+    using cm32 = nd::basic_array<int, nd::layout::first_axis_contiguous, 3, 2>;
+    constexpr cm23 acm(1, 4, 2, 5, 3, 6);
+    constexpr cm32 bcm(7, 9, 11, 8, 10, 12);
+    constexpr auto abcm = nd::matmul(acm, bcm);
+    static_assert(abcm(0, 1) == 64 && abcm(1, 0) == 139);
+    static_assert(nd::transpose(acm)(2, 1) == 6);
+    static_assert(nd::matvec(acm, nd::array<int, 3>(1, 0, -1))[1] == -2);
+}
+
+TEST(nd_linalg, det_inverse)
+{
+    static_assert(nd::det(nd::array<int, 1, 1>(5)) == 5);
+    static_assert(nd::det(nd::array<int, 2, 2>(1, 2, 3, 4)) == -2);
+    static_assert(nd::det(nd::array<int, 3, 3>(1, 2, 3, 0, 1, 4, 5, 6, 0)) == 1);
+    static_assert(nd::det(nd::array<int, 4, 4>(1, 0, 2, -1, 3, 0, 0, 5, 2, 1, 4, -3, 1, 0, 5, 0)) == 30);
+
+    constexpr nd::array<double, 2, 2> m2(2, 1, 1, 1);
+    static_assert(nd::inverse(m2) == nd::array<double, 2, 2>(1, -1, -1, 2));
+
+    constexpr nd::array<double, 3, 3> m3(1, 2, 3, 0, 1, 4, 5, 6, 0);
+    constexpr auto                    i3 = nd::inverse(m3);
+    static_assert(i3 == nd::array<double, 3, 3>(-24, 18, 5, 20, -15, -4, -5, 4, 1));
+
+    constexpr nd::array<double, 4, 4> m4(1, 0, 2, -1, 3, 0, 0, 5, 2, 1, 4, -3, 1, 0, 5, 0);
+    EXPECT_LT(max_abs_diff(nd::matmul(m4, nd::inverse(m4)), nd::identity<double, 4>()), 1e-12);
+
+    using cm4 = nd::basic_array<double, nd::layout::first_axis_contiguous, 4, 4>;
+    cm4 m4cm;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            m4cm(i, j) = m4(i, j);
+        }
+    }
+    EXPECT_DOUBLE_EQ(nd::det(m4cm), 30.0);
+    EXPECT_LT(max_abs_diff(nd::matmul(m4cm, nd::inverse(m4cm)), nd::identity<double, 4, nd::layout::first_axis_contiguous>()), 1e-12);
+
+    // general case: LU determinant and Gauss-Jordan inverse
+    nd::array<double, 5, 5> m5{};
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        for (std::size_t j = 0; j < 5; ++j)
+        {
+            m5(i, j) = i == j ? 4.0 : 1.0 / static_cast<double>(1 + i + 2 * j);
+        }
+    }
+    m5(0, 0) = 0; // requires pivoting
+
+    EXPECT_LT(max_abs_diff(nd::matmul(m5, nd::inverse(m5)), nd::identity<double, 5>()), 1e-12);
+    EXPECT_NEAR(nd::det(m5) * nd::det(nd::inverse(m5)), 1.0, 1e-12);
+
+    constexpr double d5 = nd::det(nd::identity<double, 5>());
+    static_assert(d5 == 1.0);
+}
+
+TEST(nd_linalg, symmetric_eigen)
+{
+    constexpr nd::array<double, 3, 3> diag(3, 0, 0, 0, 1, 0, 0, 0, 2);
+    constexpr auto                    ed = nd::symmetric_eigen(diag);
+    static_assert(ed.values == nd::array<double, 3>(1, 2, 3));
+    static_assert(ed.vectors(1, 0) == 1 && ed.vectors(0, 2) == 1);
+
+    constexpr nd::array<double, 2, 2> m2(2, 1, 1, 2);
+    constexpr auto                    e2 = nd::symmetric_eigen(m2);
+    static_assert(e2.values[0] > 0.999999 && e2.values[0] < 1.000001);
+    EXPECT_NEAR(e2.values[1], 3.0, 1e-12);
+    EXPECT_NEAR(std::abs(e2.vectors(0, 1)), std::sqrt(0.5), 1e-12);
+
+    const nd::array<float, 4, 4> m4(4, 1, -2, 2, 1, 2, 0, 1, -2, 0, 3, -2, 2, 1, -2, -1);
+    const auto [values, vectors] = nd::symmetric_eigen(m4);
+
+    // A V = V diag(values), V orthonormal
+    const auto av = nd::matmul(m4, vectors);
+    for (std::size_t j = 0; j < 4; ++j)
+    {
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            EXPECT_NEAR(av(i, j), vectors(i, j) * values[j], 1e-4);
+        }
+    }
+
+    EXPECT_LT(max_abs_diff(nd::matmul(nd::transpose(vectors), vectors), nd::identity<float, 4>()), 1e-5);
+    EXPECT_LE(values[0], values[1]);
+    EXPECT_LE(values[2], values[3]);
+    EXPECT_NEAR(values[0] + values[1] + values[2] + values[3], 8.0F, 1e-4);
+}
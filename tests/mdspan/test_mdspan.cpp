@@ -0,0 +1,125 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "common.h"
+#include "nd/array.h"
+#include "nd/grid.h"
+#include "nd/mdspan.h"
+#include "nd/vector.h"
+
+namespace
+{
+float
+sum_of(nd::span<const float> values)
+{
+    return std::accumulate(values.begin(), values.end(), 0.0F);
+}
+} // namespace
+
+TEST(nd_mdspan, span)
+{
+    nd::grid<float, 2> g(3, 4);
+    std::iota(g.begin(), g.end(), 0.0F);
+
+    EXPECT_EQ(g.as_span().data(), g.data().data());
+    EXPECT_EQ(g.as_span().size(), 12U);
+    EXPECT_EQ(sum_of(g.as_span()), 66.0F);
+
+    g.as_span()[5] = -1;
+    EXPECT_EQ(g(1, 1), -1.0F);
+
+    nd::vector<float> v({2, 2, 2}, 1.0F);
+    EXPECT_EQ(sum_of(v.as_span()), 8.0F);
+
+    constexpr nd::array<int, 2, 3> a = nd::array<int, 2, 3>::Constant(2);
+    static_assert(a.as_span().size() == 6);
+    static_assert(a.as_span()[4] == 2);
+
+    std::vector<float> raw(6, 0.5F);
+    EXPECT_EQ(sum_of(nd::span<float>(raw)), 3.0F);
+}
+
+TEST(nd_mdspan, mdspan)
+{
+    nd::grid<float, 3> g(2, 3, 4);
+    std::iota(g.begin(), g.end(), 0.0F);
+
+    auto m = g.as_mdspan();
+    static_assert(decltype(m)::rank() == 3);
+    EXPECT_EQ(m.data_handle(), g.data().data());
+    EXPECT_EQ(m.extent(1), 3U);
+    EXPECT_EQ(m.stride(0), 12U);
+    EXPECT_EQ(m.size(), 24U);
+    EXPECT_EQ(nd::md_at(m, 1, 2, 3), g(1, 2, 3));
+    EXPECT_EQ(nd::md_at(m, std::array<int, 3>{1, 0, 2}), g(1, 0, 2));
+
+    nd::md_at(m, 0, 1, 1) = 100;
+    EXPECT_EQ(g(0, 1, 1), 100.0F);
+
+    const nd::grid<float, 3>& cg = g;
+    EXPECT_EQ(nd::md_at(cg.as_mdspan(), 1, 1, 1), g(1, 1, 1));
+
+    nd::grid<int, 2, nd::layout::first_axis_contiguous> f(3, 5);
+    std::iota(f.begin(), f.end(), 0);
+    const auto mf = f.as_mdspan();
+    EXPECT_EQ(mf.stride(0), 1U);
+    EXPECT_EQ(mf.stride(1), 3U);
+    EXPECT_EQ(nd::md_at(mf, 2, 4), f(2, 4));
+
+    nd::vector<double> v({4, 5}, 0.0);
+    v(3, 2) = 7;
+    EXPECT_EQ(nd::md_at(v.as_mdspan<2>(), 3, 2), 7.0);
+    EXPECT_THROW((void) v.as_mdspan<3>(), std::invalid_argument);
+
+    nd::array<int, 2, 3> a;
+    a(1, 2) = 4;
+    const auto ma = a.as_mdspan();
+    static_assert(decltype(ma)::rank_dynamic() == 0);
+    static_assert(decltype(ma)::static_extent(1) == 3);
+    EXPECT_EQ(nd::md_at(ma, 1, 2), 4);
+}
+
+TEST(nd_mdspan, view_from_span)
+{
+    std::vector<float> raw(12);
+    std::iota(raw.begin(), raw.end(), 0.0F);
+
+    const auto rgb = nd::as_mdspan(nd::span<float>(raw), nd::md_extents<nd::dyn, 3>(4));
+    EXPECT_EQ(rgb.extent(0), 4U);
+    EXPECT_EQ(nd::md_at(rgb, 2, 1), 7.0F);
+    EXPECT_EQ(rgb.data_handle(), raw.data());
+
+    const auto col = nd::as_mdspan<nd::layout_left>(nd::span<const float>(raw), nd::dextents<2>(3, 4));
+    EXPECT_EQ(nd::md_at(col, 2, 1), 5.0F);
+
+    EXPECT_THROW((void) nd::as_mdspan(nd::span<float>(raw), nd::md_extents<nd::dyn, 5>(2)), std::invalid_argument);
+
+    nd::mdspan<float, nd::dextents<2>> direct(raw.data(), 6, 2);
+    nd::mdspan<const float, nd::dextents<2>> readOnly = direct;
+    EXPECT_EQ(nd::md_at(readOnly, 5, 1), 11.0F);
+}
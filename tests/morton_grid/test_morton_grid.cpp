@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/morton_grid.h"
+
+TEST(nd_morton_grid, access)
+{
+    // cubic: classic Morton order with dimension 0 in bit 0
+    nd::morton_grid<int, 3> a(4, 4, 4);
+    EXPECT_EQ(a.data().size(), 64U);
+    EXPECT_EQ(a.grid_to_list_id(1, 0, 0), 1U);
+    EXPECT_EQ(a.grid_to_list_id(0, 1, 0), 2U);
+    EXPECT_EQ(a.grid_to_list_id(0, 0, 1), 4U);
+    EXPECT_EQ(a.grid_to_list_id(2, 0, 0), 8U);
+    EXPECT_EQ(a.grid_to_list_id(3, 3, 3), 63U);
+    EXPECT_EQ(a.dimension_mask(0), 0b001001U);
+
+    // non-cubic: dimensions without bits left are skipped
+    nd::morton_grid<int, 2> b(8, 2);
+    EXPECT_EQ(b.data().size(), 16U);
+    EXPECT_EQ(b.dimension_mask(0), 0b1101U);
+    EXPECT_EQ(b.dimension_mask(1), 0b0010U);
+    EXPECT_EQ(b.grid_to_list_id(7, 1), 15U);
+
+    nd::morton_grid<int, 3> c(13, 7, 33);
+    EXPECT_EQ(c.num_values(), 13U * 7U * 33U);
+    EXPECT_EQ(c.data().size(), 16U * 8U * 64U);
+
+    for (unsigned int x = 0; x < 13; ++x)
+    {
+        for (unsigned int y = 0; y < 7; ++y)
+        {
+            for (unsigned int z = 0; z < 33; ++z)
+            {
+                const auto lid = c.grid_to_list_id(x, y, z);
+                EXPECT_EQ(c.list_to_grid_id(lid), (std::array<unsigned int, 3>{x, y, z}));
+                EXPECT_EQ(c.grid_to_list_id(std::array<unsigned int, 3>{x, y, z}), lid);
+            }
+        }
+    }
+
+    c(12, 6, 32) = 5;
+    EXPECT_EQ(c.at_grid(12, 6, 32), 5);
+    EXPECT_THROW((void) c.at_grid(13, 0, 0), std::out_of_range);
+    EXPECT_THROW((nd::morton_grid<int, 2>(1U << 16, 1U << 16)), std::length_error);
+}
+
+TEST(nd_morton_grid, neighbor)
+{
+    nd::morton_grid<int, 3> a(13, 7, 33);
+
+    for (unsigned int x = 0; x < 13; ++x)
+    {
+        for (unsigned int y = 0; y < 7; ++y)
+        {
+            for (unsigned int z = 0; z < 33; ++z)
+            {
+                const auto lid = a.grid_to_list_id(x, y, z);
+
+                if (x + 1 < 13)
+                {
+                    EXPECT_EQ(a.neighbor(lid, 0, 1), a.grid_to_list_id(x + 1, y, z));
+                }
+                if (y > 0)
+                {
+                    EXPECT_EQ(a.neighbor(lid, 1, -1), a.grid_to_list_id(x, y - 1, z));
+                }
+                if (z + 5 < 33)
+                {
+                    EXPECT_EQ(a.neighbor(lid, 2, 5), a.grid_to_list_id(x, y, z + 5));
+                }
+                if (z >= 9)
+                {
+                    EXPECT_EQ(a.neighbor(lid, 2, -9), a.grid_to_list_id(x, y, z - 9));
+                }
+            }
+        }
+    }
+}
+
+TEST(nd_morton_grid, iterator)
+{
+    nd::morton_grid<int, 2> a(3, 5);
+    a.fill(-1);
+
+    int n = 0;
+    for (auto it = a.begin(); it != a.end(); ++it)
+    {
+        const auto gid = it.grid_id();
+        EXPECT_LT(gid[0], 3U);
+        EXPECT_LT(gid[1], 5U);
+        EXPECT_EQ(it.list_id(), a.grid_to_list_id(gid));
+        *it = n++;
+    }
+
+    // Morton order, padding skipped
+    EXPECT_EQ(n, 15);
+    EXPECT_EQ(a(0, 0), 0);
+    EXPECT_EQ(a(1, 0), 1);
+    EXPECT_EQ(a(0, 1), 2);
+    EXPECT_EQ(a(1, 1), 3);
+    EXPECT_EQ(a(2, 0), 4);
+
+    const nd::morton_grid<int, 2>& c = a;
+    EXPECT_EQ(std::distance(c.begin(), c.end()), 15);
+
+    // box: last dimension fastest
+    std::vector<std::array<unsigned int, 2>> visited;
+    c.for_each_in_box({1, 2}, {3, 5}, [&](const int& v, const std::array<unsigned int, 2>& gid)
+    {
+        EXPECT_EQ(v, a(gid));
+        visited.push_back(gid);
+    });
+
+    ASSERT_EQ(visited.size(), 6U);
+    EXPECT_EQ(visited[0], (std::array<unsigned int, 2>{1, 2}));
+    EXPECT_EQ(visited[1], (std::array<unsigned int, 2>{1, 3}));
+    EXPECT_EQ(visited[3], (std::array<unsigned int, 2>{2, 2}));
+    EXPECT_EQ(visited[5], (std::array<unsigned int, 2>{2, 4}));
+}
+
+TEST(nd_morton_grid, grid_conversion)
+{
+    nd::grid<int, 3> g(21, 10, 70);
+    std::iota(g.begin(), g.end(), 0);
+
+    for (unsigned int numThreads : {1U, 3U, 0U})
+    {
+        const nd::morton_grid<int, 3>    a(g, numThreads);
+        const nd::morton_grid<double, 3> b(g, numThreads);
+
+        for (unsigned int x = 0; x < g.size(0); ++x)
+        {
+            for (unsigned int y = 0; y < g.size(1); ++y)
+            {
+                for (unsigned int z = 0; z < g.size(2); ++z)
+                {
+                    ASSERT_EQ(a(x, y, z), g(x, y, z));
+                    ASSERT_EQ(b(x, y, z), g(x, y, z));
+                }
+            }
+        }
+
+        EXPECT_EQ(a.to_grid(numThreads), g);
+        EXPECT_EQ(b.to_grid<int>(numThreads), g);
+    }
+
+    nd::grid<float, 2> h(100, 33);
+    std::iota(h.begin(), h.end(), 0.0F);
+    EXPECT_EQ((nd::morton_grid<float, 2>(h).to_grid()), h);
+
+    EXPECT_TRUE((nd::morton_grid<int, 3>(nd::grid<int, 3>()).empty()));
+}
@@ -0,0 +1,70 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <fstream>
+
+#include "common.h"
+#include "nd/pnm.h"
+
+TEST(nd_pnm, read_write_pfm)
+{
+    const std::string path = ::testing::TempDir() + "nd_pnm_test.pfm";
+
+    {
+        nd::grid<float, 2> a(3, 2);
+        a.set_values(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f);
+
+        nd::write_pfm(path, a);
+        EXPECT_EQ(nd::read_pfm<2>(path), a);
+
+        // rows are stored bottom-to-top
+        std::ifstream f(path, std::ios::binary);
+        const std::string content((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+        float first = 0;
+        std::memcpy(&first, content.data() + content.size() - 6 * sizeof(float), sizeof(float));
+        EXPECT_FLOAT_EQ(first, 4.5f);
+
+        EXPECT_THROW(nd::read_pfm<3>(path), std::runtime_error);
+    }
+    {
+        nd::grid<float, 3> a(5, 4, 3);
+        for (unsigned int i = 0; i < a.num_values(); ++i)
+        { a[i] = i * 0.25f - 3.0f; }
+
+        nd::write_pfm(path, a);
+        EXPECT_EQ(nd::read_pfm<3>(path), a);
+    }
+    {
+        // big endian file, single row
+        std::ofstream f(path, std::ios::binary);
+        f << "Pf\n2 1\n1.0\n";
+        const unsigned char data[] = {0x3F, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00}; // 1.0f, -2.0f
+        f.write(reinterpret_cast<const char*>(data), sizeof(data));
+        f.close();
+
+        const auto a = nd::read_pfm<2>(path);
+        EXPECT_FLOAT_EQ(a(0, 0), 1.0f);
+        EXPECT_FLOAT_EQ(a(0, 1), -2.0f);
+    }
+}
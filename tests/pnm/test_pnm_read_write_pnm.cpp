@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <fstream>
+
+#include "common.h"
+#include "nd/pnm.h"
+
+TEST(nd_pnm, read_write_pnm)
+{
+    const std::string path = ::testing::TempDir() + "nd_pnm_test.pnm";
+
+    {
+        nd::grid<std::uint8_t, 2> a(3, 5); // 3 rows, 5 columns
+        std::iota(a.begin(), a.end(), 0);
+
+        nd::write_pnm(path, a);
+        EXPECT_EQ((nd::read_pnm<std::uint8_t, 2>(path)), a);
+
+        const auto b = nd::read_pnm<std::uint16_t, 2>(path); // 8 bit file into 16 bit grid
+        EXPECT_EQ(b.size(0), 3U);
+        EXPECT_EQ(b.size(1), 5U);
+        EXPECT_EQ(b(2, 4), 14);
+
+        std::ifstream f(path, std::ios::binary);
+        const std::string content((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(content.substr(0, 11), "P5\n5 3\n255\n");
+        EXPECT_EQ(content.size(), 11U + 15U);
+
+        EXPECT_THROW((nd::read_pnm<std::uint8_t, 3>(path)), std::runtime_error);
+    }
+    {
+        nd::grid<std::uint16_t, 3> a(4, 7, 3);
+        for (unsigned int i = 0; i < a.num_values(); ++i)
+        { a[i] = static_cast<std::uint16_t>(i * 1000 + 1); }
+
+        nd::write_pnm(path, a);
+        EXPECT_EQ((nd::read_pnm<std::uint16_t, 3>(path)), a);
+
+        // 16 bit samples are big endian
+        std::ifstream f(path, std::ios::binary);
+        const std::string content((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+        const std::size_t headerSize = std::string("P6\n7 4\n65535\n").size();
+        EXPECT_EQ(static_cast<unsigned char>(content[headerSize + 2]), 1001 >> 8);
+        EXPECT_EQ(static_cast<unsigned char>(content[headerSize + 3]), 1001 & 0xFF);
+
+        EXPECT_THROW((nd::read_pnm<std::uint8_t, 3>(path)), std::runtime_error);
+    }
+    {
+        std::ofstream f(path, std::ios::binary);
+        f << "P5\n# comment\n2 2\n255\n\x01\x02\x03";
+        f.close();
+
+        EXPECT_THROW((nd::read_pnm<std::uint8_t, 2>(path)), std::runtime_error);
+    }
+}
@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cmath>
+#include <numeric>
+#include <cstdint>
+#include <limits>
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/reduced_precision.h"
+#include "nd/vector.h"
+
+TEST(nd_reduced_precision, half)
+{
+    EXPECT_EQ(nd::half(1.0F).bits(), 0x3C00);
+    EXPECT_EQ(nd::half(-2.0F).bits(), 0xC000);
+    EXPECT_EQ(nd::half(65504.0F).bits(), 0x7BFF);
+    EXPECT_EQ(nd::half(1e6F).bits(), 0x7C00);
+    EXPECT_EQ(nd::half(5.9604645e-8F).bits(), 0x0001);
+    EXPECT_EQ(nd::half(1.0F + 1.0F / 2048).bits(), 0x3C00); // tie, rounds to even
+    EXPECT_EQ(nd::half(1.0F + 3.0F / 2048).bits(), 0x3C02);
+    EXPECT_TRUE(std::isnan(static_cast<float>(nd::half(std::numeric_limits<float>::quiet_NaN()))));
+
+    // all finite halfs survive float round trips
+    for (std::uint32_t b = 0; b < 0x10000; ++b)
+    {
+        const nd::half h = nd::half::from_bits(static_cast<std::uint16_t>(b));
+        const float    f = h;
+
+        if (!std::isnan(f))
+        {
+            ASSERT_EQ(nd::half(f).bits(), h.bits());
+        }
+    }
+}
+
+TEST(nd_reduced_precision, bfloat16)
+{
+    EXPECT_EQ(nd::bfloat16(1.0F).bits(), 0x3F80);
+    EXPECT_EQ(static_cast<float>(nd::bfloat16(3.0F)), 3.0F);
+    EXPECT_EQ(static_cast<float>(nd::bfloat16(1.00390625F)), 1.0F); // tie, rounds to even
+    EXPECT_EQ(static_cast<float>(nd::bfloat16(1.01171875F)), 1.015625F);
+    EXPECT_TRUE(std::isnan(static_cast<float>(nd::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+namespace
+{
+//! a user reduction that nd::sum must not compete with via ADL
+template<typename TContainer>
+long long
+sum(const TContainer& c)
+{
+    return std::accumulate(c.begin(), c.end(), 0LL);
+}
+} // namespace
+
+TEST(nd_reduced_precision, containers)
+{
+    nd::grid<float, 2> g(13, 17);
+    float              x = -10;
+    for (auto& v: g)
+    {
+        v = x;
+        x += 0.25F;
+    }
+
+    const nd::grid<nd::half, 2>     h = g;
+    const nd::grid<nd::bfloat16, 2> b = g.cast<nd::bfloat16>();
+
+    EXPECT_TRUE((h.cast<float>() == g));
+    EXPECT_TRUE((nd::grid<float, 2>(b) == g));
+    EXPECT_EQ(h(3, 4), g(3, 4));
+
+    nd::vector<float> v({2, 3}, 0.0F);
+    std::iota(v.begin(), v.end(), 0.5F);
+
+    const nd::vector<nd::half> vh = v;
+    EXPECT_EQ(static_cast<float>(vh(1, 2)), 5.5F);
+    EXPECT_DOUBLE_EQ(nd::sum(vh), 18.0);
+
+    EXPECT_DOUBLE_EQ(nd::sum(h), nd::sum(g));
+    EXPECT_DOUBLE_EQ(nd::mean(b), nd::mean(g));
+    EXPECT_EQ(nd::min_max(h), std::make_pair(-10.0F, x - 0.25F));
+
+    // blocks are summed in double: 2^24 + 1 is not representable as float
+    nd::grid<float, 1> large({4}, 1.0F);
+    large[0] = 16777216.0F;
+    EXPECT_DOUBLE_EQ(nd::sum(large), 16777219.0);
+
+    // nd::sum / nd::mean / nd::min_max only accept float, half and bfloat16 values
+    const nd::grid<int, 1> ints({4}, 3);
+    EXPECT_EQ(sum(ints), 12);
+
+    EXPECT_FLOAT_EQ(nd::sample_linear(h, std::array<float, 2>{2.5F, 3.25F}), nd::sample_linear(g, std::array<float, 2>{2.5F, 3.25F}));
+    EXPECT_FLOAT_EQ(nd::sample_linear(g, std::array<float, 2>{2.5F, 3.25F}), (g(2, 3) + g(3, 3)) / 2 * 0.75F + (g(2, 4) + g(3, 4)) / 2 * 0.25F);
+    EXPECT_EQ(nd::sample_linear(g, std::array<float, 2>{100.0F, -1.0F}), g(12, 0));
+}
+
+TEST(nd_reduced_precision, quantized_grid)
+{
+    nd::grid<float, 3> g(4, 5, 6);
+    float              x = 0;
+    for (auto& v: g)
+    {
+        v = std::sin(x) * 3;
+        x += 0.1F;
+    }
+
+    for (unsigned int numThreads: {1U, 3U})
+    {
+        const nd::quantized_grid<std::uint8_t, 3>  q8(g, numThreads);
+        const nd::quantized_grid<std::uint16_t, 3> q16(g, numThreads);
+        const float                                tol8  = q8.parameters().scale / 2 + 1e-5F;
+        const float                                tol16 = q16.parameters().scale / 2 + 1e-5F;
+
+        const nd::grid<float, 3> d8 = q8.cast(numThreads);
+
+        for (unsigned int i = 0; i < g.num_values(); ++i)
+        {
+            ASSERT_NEAR(d8[i], g[i], tol8);
+            ASSERT_NEAR(q16(g.list_to_grid_id(i)), g[i], tol16);
+        }
+
+        EXPECT_NEAR(q8.mean(), nd::mean(d8), 1e-5);
+        EXPECT_NEAR(q16.mean(), nd::mean(g), tol16);
+        EXPECT_EQ(q8.min_max(), nd::min_max(d8));
+        EXPECT_NEAR(q8.sample_linear(std::array<float, 3>{1.5F, 2.0F, 3.5F}), nd::sample_linear(d8, std::array<float, 3>{1.5F, 2.0F, 3.5F}), 1e-5F);
+    }
+
+    const nd::quantized_grid<std::uint8_t, 3> fixed(g, nd::quantization<std::uint8_t>::from_range(0, 1));
+    EXPECT_EQ(fixed.min_max(), std::make_pair(0.0F, 1.0F));
+}
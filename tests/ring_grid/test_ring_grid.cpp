@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/ring_grid.h"
+
+namespace
+{
+nd::grid<int, 2>
+make_frame(int t)
+{
+    nd::grid<int, 2> f(3, 4);
+    int              i = 0;
+
+    for (auto& x: f)
+    {
+        x = 100 * t + i++;
+    }
+
+    return f;
+}
+} // namespace
+
+TEST(nd_ring_grid, push_back)
+{
+    nd::ring_grid<int, 3> r(3, 3, 4);
+
+    EXPECT_EQ(r.capacity(), 3U);
+    EXPECT_EQ(r.frame_num_values(), 12U);
+    EXPECT_TRUE(r.empty());
+    EXPECT_TRUE(r.spans()[0].empty());
+
+    r.push_back(make_frame(0));
+    r.push_back(make_frame(1));
+    EXPECT_EQ(r.num_frames(), 2U);
+    EXPECT_FALSE(r.full());
+    EXPECT_EQ(r(1, 2, 3), 111);
+    EXPECT_EQ(r.spans()[0].size(), 24U);
+    EXPECT_TRUE(r.spans()[1].empty());
+
+    r.push_back(make_frame(2));
+    r.push_back(make_frame(3));
+    r.push_back(make_frame(4));
+    EXPECT_TRUE(r.full());
+    EXPECT_EQ(r.size()[0], 3U);
+    EXPECT_EQ(r(0, 0, 0), 200);
+    EXPECT_EQ(r(std::array<int, 3>{2, 1, 1}), 405);
+    EXPECT_EQ(r.frame(1)[11], 311);
+
+    const auto spans = r.spans();
+    EXPECT_EQ(spans[0].size(), 12U);
+    EXPECT_EQ(spans[1].size(), 24U);
+    EXPECT_EQ(spans[0][0], 200);
+    EXPECT_EQ(spans[1][0], 300);
+    EXPECT_EQ(spans[1][12], 400);
+
+    nd::grid<int, 3> g = r.to_grid();
+    EXPECT_EQ(g.size(0), 3U);
+    EXPECT_EQ(g(0, 1, 2), 206);
+    EXPECT_EQ(g(2, 2, 3), 411);
+
+    r.pop_front();
+    EXPECT_EQ(r.num_frames(), 2U);
+    EXPECT_EQ(r(0, 0, 0), 300);
+
+    const auto f = make_frame(5);
+    r.push_back(f.data().begin());
+    EXPECT_EQ(r(2, 0, 1), 501);
+
+    auto slot = r.push_back_uninitialized();
+    std::fill(slot.begin(), slot.end(), -1);
+    EXPECT_EQ(r(2, 2, 2), -1);
+    EXPECT_EQ(r(0, 0, 0), 400);
+
+    EXPECT_THROW(r.push_back(nd::grid<int, 2>(4, 3)), std::invalid_argument);
+
+    r.clear();
+    EXPECT_TRUE(r.empty());
+    EXPECT_TRUE(r.to_grid().empty());
+}
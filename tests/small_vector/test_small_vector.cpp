@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "common.h"
+#include "nd/small_vector.h"
+#include "nd/vector.h"
+
+TEST(nd_small_vector, inline_storage)
+{
+    nd::small_vector<unsigned int, 4> a = {3, 4, 5};
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_EQ(a.size(), 3U);
+    EXPECT_EQ(a.capacity(), 4U);
+    EXPECT_EQ(a[1], 4U);
+    EXPECT_EQ(a.back(), 5U);
+
+    a.push_back(6);
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_EQ(std::accumulate(a.begin(), a.end(), 0U), 18U);
+
+    nd::small_vector<unsigned int, 4> b(a);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(b.data(), a.data());
+
+    nd::small_vector<unsigned int, 4> c(std::move(b));
+    EXPECT_EQ(a, c);
+    EXPECT_TRUE(c.is_inline());
+    EXPECT_TRUE(b.empty());
+
+    c.resize(2);
+    EXPECT_NE(a, c);
+    c.resize(3, 7);
+    EXPECT_EQ(c, (nd::small_vector<unsigned int, 4>{3, 4, 7}));
+
+    c.clear();
+    EXPECT_TRUE(c.empty());
+}
+
+TEST(nd_small_vector, heap_storage)
+{
+    nd::small_vector<int, 2> a(5, 1);
+    EXPECT_FALSE(a.is_inline());
+    EXPECT_EQ(a.size(), 5U);
+
+    a.push_back(a[0]);
+    EXPECT_EQ(a.size(), 6U);
+    EXPECT_EQ(a.back(), 1);
+
+    const int* heap = a.data();
+    nd::small_vector<int, 2> b(std::move(a));
+    EXPECT_EQ(b.data(), heap);
+    EXPECT_TRUE(a.is_inline());
+
+    nd::small_vector<int, 2> c = {1, 2};
+    c = b;
+    EXPECT_EQ(c, b);
+    c = std::move(b);
+    EXPECT_EQ(c.data(), heap);
+
+    c.resize(2);
+    c.shrink_to_fit();
+    EXPECT_TRUE(c.is_inline());
+    EXPECT_EQ(c, (nd::small_vector<int, 2>{1, 1}));
+
+    nd::small_vector<int, 2> d = {9};
+    swap(c, d);
+    EXPECT_EQ(c.size(), 1U);
+    EXPECT_EQ(d.size(), 2U);
+}
+
+TEST(nd_small_vector, vector_shape)
+{
+    nd::vector<float> small(2, 3, 4);
+    EXPECT_TRUE(small.size().is_inline());
+    EXPECT_TRUE(small.strides().is_inline());
+
+    nd::vector<float> copy(small);
+    EXPECT_EQ(copy.size(), small.size());
+    EXPECT_EQ(copy.stride(0), 12U);
+
+    // more than 8 dimensions fall back to heap storage
+    const std::vector<unsigned int> sizes = {2, 1, 2, 1, 2, 1, 2, 1, 2, 1};
+    nd::vector<int> large(sizes.begin(), sizes.end(), 0);
+    std::iota(large.begin(), large.end(), 0);
+
+    EXPECT_FALSE(large.size().is_inline());
+    EXPECT_EQ(large.num_dimensions(), 10U);
+    EXPECT_EQ(large.num_values(), 32U);
+    EXPECT_EQ(large(1, 0, 1, 0, 1, 0, 1, 0, 1, 0), 31);
+
+    nd::vector<int> moved(std::move(large));
+    EXPECT_EQ(moved.size()[8], 2U);
+    EXPECT_EQ(moved.stride(0), 16U);
+
+    // conversion to std::vector as returned by size() / strides() before
+    const std::vector<unsigned int>& movedSizes = moved.size();
+    EXPECT_EQ(movedSizes, sizes);
+    EXPECT_EQ(moved.strides().to_vector().front(), 16U);
+}
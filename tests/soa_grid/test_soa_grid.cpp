@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+#include "common.h"
+#include "nd/array.h"
+#include "nd/grid.h"
+#include "nd/soa_grid.h"
+
+TEST(nd_soa_grid, access)
+{
+    nd::soa_grid<2, int, double> g({3, 4}, std::make_tuple(1, 0.5));
+
+    EXPECT_EQ(g.num_values(), 12U);
+    EXPECT_EQ(g.stride(0), 4U);
+    EXPECT_EQ(g.channel<0>().size(), 12U);
+    EXPECT_EQ(g.get<1>(2, 3), 0.5);
+
+    g(1, 2) = std::make_tuple(7, 2.5);
+    EXPECT_EQ(g.channel<0>()[g.grid_to_list_id(1, 2)], 7);
+    EXPECT_EQ(g.get<1>(std::array<int, 2>{1, 2}), 2.5);
+
+    auto [i, d] = g(1, 2);
+    i = 8;
+    d += 1;
+    EXPECT_EQ(g.get<0>(1, 2), 8);
+    EXPECT_EQ(g.get<1>(1, 2), 3.5);
+
+    g(0, 0) = g(1, 2);
+    EXPECT_EQ(g(0, 0), std::make_tuple(8, 3.5));
+    EXPECT_EQ(g(0, 0), g(1, 2));
+    EXPECT_NE(g(0, 1), g(1, 2));
+
+    const std::tuple<int, double> t = g(0, 0);
+    EXPECT_EQ(std::get<0>(t), 8);
+
+    const auto gid = g.list_to_grid_id(g.grid_to_list_id(2, 1));
+    EXPECT_EQ(gid[0], 2U);
+    EXPECT_EQ(gid[1], 1U);
+
+    unsigned int n = 0;
+    for (auto e: g)
+    {
+        e.get<0>() = static_cast<int>(n++);
+    }
+
+    EXPECT_EQ(n, g.num_values());
+    EXPECT_EQ(g.get<0>(2, 3), 11);
+}
+
+TEST(nd_soa_grid, copy_from_const)
+{
+    nd::soa_grid<2, int, double> a({2, 3}, std::make_tuple(0, 0.0));
+    nd::soa_grid<2, int, double> b({2, 3}, std::make_tuple(0, 0.0));
+
+    for (unsigned int i = 0; i < b.num_values(); ++i)
+    {
+        b[i] = std::make_tuple(static_cast<int>(i), 0.5 * i);
+    }
+
+    const nd::soa_grid<2, int, double>& cb = b;
+
+    a(0, 0) = cb(1, 1);
+    EXPECT_EQ(a(0, 0), std::make_tuple(4, 2.0));
+
+    std::copy(cb.begin(), cb.end(), a.begin());
+
+    for (unsigned int i = 0; i < a.num_values(); ++i)
+    {
+        EXPECT_EQ(a[i], cb[i]);
+    }
+}
+
+TEST(nd_soa_grid, aos_conversion)
+{
+    nd::grid<std::array<float, 3>, 3> aos({7, 33, 19});
+
+    float x = 0;
+    for (auto& e: aos)
+    {
+        e = {x, x + 0.5F, -x};
+        x += 1;
+    }
+
+    for (unsigned int numThreads: {1U, 4U})
+    {
+        const nd::soa_grid<3, float, float, float> soa(aos, numThreads);
+
+        EXPECT_EQ(soa.size(), aos.size());
+        EXPECT_EQ(soa.get<1>(3, 20, 5), aos(3, 20, 5)[1]);
+        EXPECT_EQ(soa.get<2>(6, 32, 18), aos(6, 32, 18)[2]);
+        EXPECT_TRUE((soa.to_grid<std::array<float, 3>>(numThreads) == aos));
+    }
+
+    nd::soa_grid<3, float, float, float> soa(aos);
+    soa(1, 2, 3) = nd::array<float, 3>(1.F, 2.F, 3.F);
+
+    const nd::grid<nd::array<float, 3>, 3> aos2 = soa.to_grid<nd::array<float, 3>>();
+    EXPECT_EQ(aos2(1, 2, 3)[2], 3.F);
+    EXPECT_EQ(aos2(4, 5, 6)[0], aos(4, 5, 6)[0]);
+    EXPECT_EQ((soa(1, 2, 3).as<nd::array<float, 3>>()[1]), 2.F);
+
+    const nd::soa_grid<3, double, double, double> soa2(aos2);
+    EXPECT_EQ(soa2.get<0>(4, 5, 6), static_cast<double>(aos(4, 5, 6)[0]));
+
+    nd::grid<std::tuple<float, float, float>, 3> aos3 = soa.to_grid();
+    EXPECT_EQ(std::get<1>(aos3(1, 2, 3)), 2.F);
+}
@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/sparse_grid.h"
+
+namespace
+{
+//! sphere-like blob on background 5
+nd::grid<float, 3>
+make_dense()
+{
+    nd::grid<float, 3> g({37, 20, 45}, 5.F);
+
+    for (unsigned int x = 0; x < 37; ++x)
+    {
+        for (unsigned int y = 0; y < 20; ++y)
+        {
+            for (unsigned int z = 0; z < 45; ++z)
+            {
+                const int dx = static_cast<int>(x) - 20;
+                const int dy = static_cast<int>(y) - 10;
+                const int dz = static_cast<int>(z) - 30;
+
+                if (dx * dx + dy * dy + dz * dz < 49)
+                {
+                    g(x, y, z) = static_cast<float>(x + y + z);
+                }
+            }
+        }
+    }
+
+    g(36, 19, 44) = -1.F;
+    return g;
+}
+} // namespace
+
+TEST(nd_sparse_grid, access)
+{
+    nd::sparse_grid<int, 2, 2> s({10, 9}, -1);
+
+    EXPECT_EQ(s.num_leaves(), 0U);
+    EXPECT_EQ(s.num_leaves_dense(), 9U);
+    EXPECT_EQ(s(3, 4), -1);
+    EXPECT_FALSE(s.is_active(3, 4));
+
+    s.touch(3, 4) = 7;
+    s.set_value(std::array<int, 2>{9, 8}, 8);
+    EXPECT_EQ(s(3, 4), 7);
+    EXPECT_EQ(s(std::array<int, 2>{9, 8}), 8);
+    EXPECT_EQ(s(3, 5), -1);
+    EXPECT_TRUE(s.is_active(3, 4));
+    EXPECT_FALSE(s.is_active(3, 5));
+    EXPECT_EQ(s.num_leaves(), 2U);
+    EXPECT_EQ(s.num_active(), 2U);
+    EXPECT_NE(s.find_leaf(2, 5), nullptr);
+    EXPECT_EQ(s.find_leaf(0, 0), nullptr);
+
+    int sum = 0;
+    s.for_each_active([&](const auto& gid, int& v)
+    {
+        sum += v;
+        v += static_cast<int>(gid[0]);
+    });
+    EXPECT_EQ(sum, 15);
+    EXPECT_EQ(s(9, 8), 17);
+
+    s.deactivate(3, 4);
+    EXPECT_EQ(s(3, 4), -1);
+    EXPECT_EQ(s.num_leaves(), 2U);
+    s.prune();
+    EXPECT_EQ(s.num_leaves(), 1U);
+    EXPECT_EQ(s(9, 8), 17);
+}
+
+TEST(nd_sparse_grid, dense_conversion)
+{
+    const nd::grid<float, 3> dense = make_dense();
+
+    for (unsigned int numThreads: {1U, 4U})
+    {
+        const nd::sparse_grid<float, 3> s(dense, 5.F, 0.F, numThreads);
+
+        EXPECT_EQ(s.background(), 5.F);
+        EXPECT_LT(s.num_leaves(), s.num_leaves_dense() / 4);
+        EXPECT_LT(s.memory_usage(), dense.num_values() * sizeof(float) / 2);
+        EXPECT_EQ(s(36, 19, 44), -1.F);
+        EXPECT_EQ(s(20, 10, 30), 60.F);
+        EXPECT_EQ(s(0, 0, 0), 5.F);
+        EXPECT_TRUE((s.to_grid(numThreads) == dense));
+    }
+
+    const nd::sparse_grid<float, 3> t(dense, 5.F, 60.F);
+    std::size_t                     numAboveTolerance = 0;
+
+    for (const float v: dense)
+    {
+        numAboveTolerance += v > 65.F;
+    }
+
+    EXPECT_EQ(t.num_active(), numAboveTolerance);
+    EXPECT_FALSE(t.is_active(36, 19, 44));
+    t.for_each_active([](const auto&, float v)
+    {
+        EXPECT_GT(v, 65.F);
+    });
+}
+
+TEST(nd_sparse_grid, dense_conversion_bool)
+{
+    nd::grid<bool, 3> dense({37, 20, 45}, false);
+    const auto        blob = make_dense();
+
+    for (unsigned int i = 0; i < dense.num_values(); ++i)
+    {
+        dense.data()[i] = blob[i] != 5.F;
+    }
+
+    const nd::sparse_grid<bool, 3> s(dense, false, false, 4);
+
+    EXPECT_TRUE(s(20, 10, 30));
+    EXPECT_FALSE(s(0, 0, 0));
+    EXPECT_TRUE((s.to_grid(4).data() == dense.data()));
+}
+
+TEST(nd_sparse_grid, topology)
+{
+    nd::sparse_grid<int, 3> a({40, 40, 40}, 0);
+    nd::sparse_grid<char, 3> b({40, 40, 40}, 0);
+
+    a.touch(1, 1, 1) = 1;
+    a.touch(2, 1, 1) = 2;
+    a.touch(30, 30, 30) = 3;
+    b.touch(2, 1, 1) = 1;
+    b.touch(20, 20, 20) = 1;
+
+    nd::sparse_grid<int, 3> u = a;
+    u.topology_union(b);
+    EXPECT_EQ(u.num_active(), 4U);
+    EXPECT_TRUE(u.is_active(20, 20, 20));
+    EXPECT_EQ(u(20, 20, 20), 0);
+    EXPECT_EQ(u(2, 1, 1), 2);
+
+    nd::sparse_grid<int, 3> i = a;
+    i.topology_intersection(b);
+    EXPECT_EQ(i.num_active(), 1U);
+    EXPECT_EQ(i.num_leaves(), 1U);
+    EXPECT_EQ(i(2, 1, 1), 2);
+    EXPECT_EQ(i(1, 1, 1), 0);
+    EXPECT_FALSE(i.is_active(30, 30, 30));
+}
@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <random>
+#include <stdexcept>
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/sparse_matrix.h"
+
+TEST(nd_sparse_matrix, coo_to_csr)
+{
+    nd::coo_matrix<double> coo(4, 5);
+    coo.add(2, 4, 1.0);
+    coo.add(0, 1, 2.0);
+    coo.add(2, 0, 3.0);
+    coo.add(2, 4, 0.5);
+    coo.add(3, 3, 4.0);
+    coo.add(0, 1, 1.0);
+
+    for (unsigned int numThreads: {1U, 3U})
+    {
+        const nd::sparse_matrix<double> a(coo, numThreads);
+
+        EXPECT_EQ(a.num_rows(), 4U);
+        EXPECT_EQ(a.num_cols(), 5U);
+        EXPECT_EQ(a.num_nonzeros(), 4U);
+        EXPECT_EQ(a.row_offsets(), (std::vector<unsigned int>{0, 1, 1, 3, 4}));
+        EXPECT_EQ(a.col_ids(), (std::vector<unsigned int>{1, 0, 4, 3}));
+        EXPECT_EQ(a.values(), (std::vector<double>{3.0, 3.0, 1.5, 4.0}));
+        EXPECT_EQ(a(2, 4), 1.5);
+        EXPECT_EQ(a(1, 1), 0.0);
+    }
+}
+
+TEST(nd_sparse_matrix, dense_and_spmv)
+{
+    std::mt19937                     rng(7);
+    std::uniform_real_distribution<> dist(-1.0, 1.0);
+
+    nd::grid<double, 2> dense({53, 41}, 0.0);
+    for (auto& v: dense)
+    {
+        const double r = dist(rng);
+        v = std::abs(r) > 0.8 ? r : (std::abs(r) < 0.05 ? 0.01 : 0.0);
+    }
+
+    nd::grid<double, 1> x(41);
+    for (auto& v: x)
+    {
+        v = dist(rng);
+    }
+
+    const nd::sparse_matrix<double> a(dense, 0.02, 2);
+    EXPECT_LT(a.num_nonzeros(), dense.num_values() / 4);
+
+    nd::coo_matrix<double> coo(53, 41);
+    for (unsigned int r = 0; r < 53; ++r)
+    {
+        for (unsigned int c = 0; c < 41; ++c)
+        {
+            if (std::abs(dense(r, c)) > 0.02)
+            {
+                coo.add(r, c, dense(r, c) / 2);
+                coo.add(r, c, dense(r, c) / 2);
+            }
+            else
+            {
+                dense(r, c) = 0.0;
+            }
+        }
+    }
+
+    EXPECT_TRUE((a.to_grid() == dense));
+    EXPECT_TRUE((nd::sparse_matrix<double>(coo, 4).to_grid() == dense));
+
+    for (unsigned int numThreads: {1U, 4U})
+    {
+        nd::grid<double, 1> y;
+        a.multiply(x, y, numThreads);
+        ASSERT_EQ(y.num_values(), 53U);
+
+        for (unsigned int r = 0; r < 53; ++r)
+        {
+            double expected = 0;
+            for (unsigned int c = 0; c < 41; ++c)
+            {
+                expected += dense(r, c) * x(c);
+            }
+
+            EXPECT_NEAR(y(r), expected, 1e-12);
+        }
+    }
+
+    EXPECT_EQ((a * x).num_values(), 53U);
+    EXPECT_THROW(static_cast<void>(a * nd::grid<double, 1>(40)), std::invalid_argument);
+}
+
+TEST(nd_sparse_matrix, multiply_in_place)
+{
+    nd::coo_matrix<double> coo(3, 3);
+    coo.add(0, 1, 2.0);
+    coo.add(1, 0, 1.0);
+    coo.add(2, 2, 1.0);
+
+    const nd::sparse_matrix<double> a(coo);
+
+    for (unsigned int numThreads: {1U, 3U})
+    {
+        nd::grid<double, 1> x(3);
+        x.fill(1.0);
+
+        a.multiply(x, x, numThreads);
+        ASSERT_EQ(x.num_values(), 3U);
+        EXPECT_EQ(x[0], 2.0);
+        EXPECT_EQ(x[1], 1.0);
+        EXPECT_EQ(x[2], 1.0);
+    }
+}
+
+TEST(nd_sparse_matrix, dense_unsigned)
+{
+    nd::grid<unsigned int, 2> dense({3, 4}, 0U);
+    dense(0, 1) = 1;
+    dense(1, 3) = 5;
+    dense(2, 0) = 9;
+
+    const nd::sparse_matrix<unsigned int> a(dense, 1U);
+    EXPECT_EQ(a.num_nonzeros(), 2U);
+
+    dense(0, 1) = 0;
+    EXPECT_TRUE((a.to_grid() == dense));
+}
@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/tiled_grid.h"
+
+TEST(nd_tiled_grid, access)
+{
+    using tiled = nd::tiled_grid<int, 3, 4, 2, 8>;
+
+    static_assert(tiled::brick_size(0) == 4);
+    static_assert(tiled::brick_size(1) == 2);
+    static_assert(tiled::brick_size(2) == 8);
+    static_assert(tiled::brick_num_values() == 64);
+    static_assert(nd::tiled_grid<float, 3>::brick_num_values() == 512);
+
+    tiled t(9, 3, 8);
+    EXPECT_EQ(t.num_values(), 9U * 3U * 8U);
+    EXPECT_EQ(t.num_bricks(0), 3U);
+    EXPECT_EQ(t.num_bricks(1), 2U);
+    EXPECT_EQ(t.num_bricks(2), 1U);
+    EXPECT_EQ(t.num_bricks(), 6U);
+    EXPECT_EQ(t.data().size(), 6U * 64U);
+
+    // values of a brick are contiguous, last dimension fastest
+    EXPECT_EQ(t.grid_to_list_id(0, 0, 1), 1U);
+    EXPECT_EQ(t.grid_to_list_id(0, 1, 0), 8U);
+    EXPECT_EQ(t.grid_to_list_id(1, 0, 0), 16U);
+    EXPECT_EQ(t.grid_to_list_id(0, 2, 0), 64U);
+    EXPECT_EQ(t.grid_to_list_id(4, 0, 0), 128U);
+    EXPECT_EQ(t.grid_to_list_id(std::array<int, 3>{4, 0, 0}), 128U);
+
+    int v = 0;
+    for (unsigned int x = 0; x < 9; ++x)
+    {
+        for (unsigned int y = 0; y < 3; ++y)
+        {
+            for (unsigned int z = 0; z < 8; ++z)
+            {
+                t(x, y, z) = v++;
+
+                const auto lid = t.grid_to_list_id(x, y, z);
+                EXPECT_EQ(t.list_to_grid_id(lid), (std::array<unsigned int, 3>{x, y, z}));
+            }
+        }
+    }
+
+    EXPECT_EQ(t(8, 2, 7), v - 1);
+    EXPECT_THROW((void) t.at_grid(9, 0, 0), std::out_of_range);
+    EXPECT_THROW((void) t.at_grid(0, 3, 0), std::out_of_range);
+}
+
+TEST(nd_tiled_grid, iterator)
+{
+    nd::tiled_grid<int, 2, 4, 4> t(6, 5);
+    t.fill(-1);
+
+    int v = 0;
+    for (auto it = t.begin(); it != t.end(); ++it)
+    {
+        const auto gid = it.grid_id();
+        EXPECT_LT(gid[0], 6U);
+        EXPECT_LT(gid[1], 5U);
+        EXPECT_EQ(it.list_id(), t.grid_to_list_id(gid));
+        *it = v++;
+    }
+
+    // all values visited once in brick order, padding skipped
+    EXPECT_EQ(v, 30);
+    EXPECT_EQ(t(0, 3), 3);
+    EXPECT_EQ(t(1, 0), 4);
+    EXPECT_EQ(t(0, 4), 16);
+    EXPECT_EQ(t(4, 0), 20);
+    EXPECT_EQ(std::accumulate(t.begin(), t.end(), 0), 29 * 30 / 2);
+
+    const nd::tiled_grid<int, 2, 4, 4>& c = t;
+    EXPECT_EQ(std::distance(c.begin(), c.end()), 30);
+
+    nd::tiled_grid<int, 2> e;
+    EXPECT_TRUE(e.begin() == e.end());
+}
+
+TEST(nd_tiled_grid, grid_conversion)
+{
+    nd::grid<int, 3> g(21, 10, 13);
+    std::iota(g.begin(), g.end(), 0);
+
+    for (unsigned int numThreads : {1U, 3U, 0U})
+    {
+        const nd::tiled_grid<int, 3>          a(g, numThreads);
+        const nd::tiled_grid<double, 3, 4, 8, 2> b(g, numThreads);
+
+        for (unsigned int x = 0; x < g.size(0); ++x)
+        {
+            for (unsigned int y = 0; y < g.size(1); ++y)
+            {
+                for (unsigned int z = 0; z < g.size(2); ++z)
+                {
+                    ASSERT_EQ(a(x, y, z), g(x, y, z));
+                    ASSERT_EQ(b(x, y, z), g(x, y, z));
+                }
+            }
+        }
+
+        EXPECT_EQ(a.to_grid(numThreads), g);
+        EXPECT_EQ(b.to_grid<int>(numThreads), g);
+    }
+
+    nd::grid<float, 1> h(100);
+    std::iota(h.begin(), h.end(), 0.0F);
+    EXPECT_EQ((nd::tiled_grid<float, 1>(h).to_grid()), h);
+
+    EXPECT_TRUE((nd::tiled_grid<int, 3>(nd::grid<int, 3>()).empty()));
+}
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/vector.h"
+
+TEST(nd_vector, append_slice)
+{
+    {
+        nd::vector<int> a;
+
+        for (int z = 0; z < 5; ++z)
+        {
+            nd::vector<int> slice({2, 3, 2});
+            std::iota(slice.begin(), slice.end(), 100 * z);
+            a.append_slice(slice);
+        }
+
+        EXPECT_EQ(a.num_dimensions(), 4U);
+        EXPECT_EQ(a.size(0), 5U);
+        EXPECT_EQ(a.size(3), 2U);
+        EXPECT_EQ(a.num_values(), 60U);
+        EXPECT_EQ(a.stride(0), 12U);
+
+        for (int z = 0; z < 5; ++z)
+        {
+            EXPECT_EQ(a(z, 0, 0, 0), 100 * z);
+            EXPECT_EQ(a(z, 1, 2, 1), 100 * z + 11);
+        }
+    }
+    {
+        nd::vector<int> a;
+        a.append_slice(nd::grid<int, 2>(3, 3));
+
+        const std::vector<int> values(9, 1);
+        a.append_slice(values.begin(), values.end());
+
+        EXPECT_EQ(a.num_dimensions(), 3U);
+        EXPECT_EQ(a.size(0), 2U);
+        EXPECT_EQ(a(1, 2, 2), 1);
+
+        EXPECT_THROW(a.append_slice(nd::vector<int>({3, 3, 1})), std::invalid_argument);
+        EXPECT_THROW(a.append_slice(nd::vector<int>({3, 2})), std::invalid_argument);
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/vector.h"
+
+TEST(nd_vector, from_string)
+{
+    {
+        nd::vector<int> a({5});
+        a.set_values(1, -2, 3, 4, 5);
+        EXPECT_EQ(a.to_string(), "[1, -2, 3, 4, 5]");
+
+        const auto b = nd::vector<int>::from_string(a.to_string());
+        EXPECT_EQ(b.num_dimensions(), 1U);
+        EXPECT_EQ(b, a);
+    }
+    {
+        nd::vector<int> a({3, 2});
+        std::iota(a.begin(), a.end(), 0);
+        EXPECT_EQ(a.to_string(), "[[0, 2, 4]\n [1, 3, 5]]");
+
+        const auto b = nd::vector<int>::from_string(a.to_string());
+        EXPECT_EQ(b.num_dimensions(), 2U);
+        EXPECT_EQ(b, a);
+    }
+    {
+        nd::vector<float> a({2, 1, 3, 2});
+        for (unsigned int i = 0; i < a.num_values(); ++i)
+        { a[i] = i * 0.1f; }
+
+        const auto b = nd::vector<float>::from_string(a.to_string());
+        EXPECT_EQ(b.num_dimensions(), 4U);
+        EXPECT_EQ(b, a);
+    }
+    {
+        const auto a = nd::vector<int>::from_string(" [ ] ");
+        EXPECT_TRUE(a.empty());
+        EXPECT_EQ(a.num_dimensions(), 0U);
+    }
+    {
+        EXPECT_THROW(static_cast<void>(nd::vector<int>::from_string("[(0,0)=1, (0,0,1)=2]")), std::invalid_argument);
+        EXPECT_THROW(static_cast<void>(nd::vector<int>::from_string("[1, 2] 3")), std::invalid_argument);
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common.h"
+#include "nd/vector.h"
+
+TEST(nd_vector, layout)
+{
+    using vector_f = nd::vector<int, nd::layout::first_axis_contiguous>;
+
+    static_assert(vector_f::memory_layout() == nd::layout::first_axis_contiguous);
+
+    vector_f a(4, 3, 2);
+    EXPECT_EQ(a.stride(0), 1U);
+    EXPECT_EQ(a.stride(1), 4U);
+    EXPECT_EQ(a.stride(2), 12U);
+
+    for (unsigned int lid = 0; lid < a.num_values(); ++lid)
+    {
+        const auto gid = a.list_to_grid_id(lid);
+        EXPECT_EQ(a.grid_to_list_id(gid), lid);
+    }
+
+    std::iota(a.begin(), a.end(), 0);
+    EXPECT_EQ(a(1, 0, 0), 1);
+    EXPECT_EQ(a(0, 1, 0), 4);
+    EXPECT_EQ(a(0, 0, 1), 12);
+
+    const nd::vector<int> b(a);
+    EXPECT_EQ(b.stride(2), 1U);
+    EXPECT_EQ(b(3, 2, 1), a(3, 2, 1));
+    EXPECT_EQ(b(1, 2, 0), a(1, 2, 0));
+    EXPECT_EQ(vector_f(b), a);
+
+    EXPECT_EQ(a.to_string(), b.to_string());
+    EXPECT_EQ(vector_f::from_string(b.to_string()), a);
+
+    vector_f        c;
+    nd::vector<int> slice(2);
+    for (int i = 0; i < 3; ++i)
+    {
+        slice(0) = 2 * i;
+        slice(1) = 2 * i + 1;
+        c.append_slice(slice);
+    }
+
+    EXPECT_EQ(c.size(0), 2U);
+    EXPECT_EQ(c.size(1), 3U);
+    EXPECT_EQ(c(1, 2), 5);
+}
@@ -22,6 +22,12 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
 #include "common.h"
 #include "nd/vector.h"
 
@@ -74,3 +80,30 @@ TEST(nd_vector, list_to_grid_id)
         EXPECT_EQ(gid4[2], 4);
     }
 }
+
+TEST(nd_vector, list_to_grid_ids)
+{
+    nd::vector<int, nd::layout::first_axis_contiguous> a({5, 7, 3, 6});
+
+    std::vector<unsigned int> lids(a.num_values());
+    std::iota(lids.begin(), lids.end(), 0U);
+
+    std::vector<unsigned int> gids(4 * lids.size());
+    const auto                end = a.list_to_grid_ids(lids.begin(), lids.end(), gids.begin());
+    EXPECT_EQ(end, gids.end());
+
+    for (unsigned int lid = 0; lid < a.num_values(); ++lid)
+    {
+        const auto gid = a.list_to_grid_id(lid);
+        ASSERT_EQ(gid.size(), 4U);
+        EXPECT_TRUE(std::equal(gid.begin(), gid.end(), gids.begin() + 4 * lid));
+        EXPECT_EQ(a.grid_to_list_id(gid), lid);
+    }
+
+    // divisors follow copies with value conversion and resize
+    const nd::vector<float, nd::layout::first_axis_contiguous> b(a);
+    EXPECT_EQ(b.list_to_grid_id(1 + 2 * 5 + 1 * 35 + 5 * 105), (std::vector<unsigned int>{1, 2, 1, 5}));
+
+    a.resize({1000, 3}, 0);
+    EXPECT_EQ(a.list_to_grid_id(1 * 1000 + 999), (std::vector<unsigned int>{999, 1}));
+}
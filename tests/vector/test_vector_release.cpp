@@ -0,0 +1,61 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2018-2020 Benjamin Köhler
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "common.h"
+#include "nd/grid.h"
+#include "nd/vector.h"
+
+TEST(nd_vector, release)
+{
+    std::vector<int> raw(24);
+    std::iota(raw.begin(), raw.end(), 0);
+    const int* p = raw.data();
+
+    // adopt
+    nd::vector<int, nd::layout::first_axis_contiguous> v = nd::vector<int, nd::layout::first_axis_contiguous>::from_vector(std::move(raw), {2, 3, 4});
+    EXPECT_EQ(v.data().data(), p);
+    EXPECT_EQ(v.num_dimensions(), 3U);
+    EXPECT_EQ(v.stride(0), 1U);
+    EXPECT_EQ(v(1, 2, 3), 1 + 2 * 2 + 3 * 6);
+
+    EXPECT_THROW(static_cast<void>(nd::vector<int>::from_vector(std::vector<int>(5), {2, 3})), std::invalid_argument);
+
+    // grid -> vector
+    nd::grid<int, 3, nd::layout::first_axis_contiguous> g(std::move(v));
+    nd::vector<int, nd::layout::first_axis_contiguous> v2(std::move(g));
+    EXPECT_EQ(v2.data().data(), p);
+    EXPECT_EQ(v2.size()[2], 4U);
+    EXPECT_EQ(v2.stride(2), 6U);
+    EXPECT_TRUE(g.empty());
+
+    // release
+    std::vector<int> values = v2.release();
+    EXPECT_EQ(values.data(), p);
+    EXPECT_TRUE(v2.empty());
+    EXPECT_EQ(v2.num_dimensions(), 0U);
+}